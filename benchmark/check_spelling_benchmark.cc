@@ -0,0 +1,147 @@
+// Measures checking a text with a Hunspell thread view, and counts the heap
+// allocations made per word once the view is warmed up.
+//
+// Build it with the addon by configuring with the benchmark target enabled:
+//
+//   node-gyp rebuild -- -Dspellchecker_benchmark=true
+//   ./build/Release/spellchecker_benchmark spec/dictionaries en_US
+//
+// The benchmark links libuv itself, so it needs the libuv development files.
+// Allocations are counted through operator new everywhere, and through malloc
+// as well with glibc, which Hunspell mostly allocates with.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "../src/spellchecker_hunspell.h"
+
+using namespace spellchecker;
+
+namespace {
+
+std::atomic<size_t> g_allocations(0);
+
+// A paragraph of correctly and incorrectly spelled words, punctuation and
+// numbers, repeated to make the text.
+const char kParagraph[] =
+  "The quick brown fox jumps over the lazy dog, while the caat sleeps. "
+  "Spelling mistakes like recieve and seperate are common; numbers like "
+  "1234 and words like don't or it's are not. Wouldn't you agree? ";
+
+const int kRepeat = 2000;
+const int kRounds = 20;
+
+std::vector<uint16_t> MakeText() {
+  std::vector<uint16_t> text;
+  for (int i = 0; i < kRepeat; i++) {
+    text.insert(text.end(), kParagraph, kParagraph + sizeof(kParagraph) - 1);
+  }
+
+  text.push_back(0);
+  return text;
+}
+
+size_t CountWords(const std::vector<uint16_t>& text) {
+  size_t words = 0;
+  bool inWord = false;
+
+  for (size_t i = 0; i < text.size(); i++) {
+    bool letter = (text[i] >= 'a' && text[i] <= 'z') || (text[i] >= 'A' && text[i] <= 'Z') || text[i] == '\'';
+    if (letter && !inWord) {
+      words++;
+    }
+
+    inWord = letter;
+  }
+
+  return words;
+}
+
+}  // namespace
+
+void *operator new(size_t size) {
+  g_allocations++;
+
+  void *result = malloc(size ? size : 1);
+  if (!result) {
+    throw std::bad_alloc();
+  }
+
+  return result;
+}
+
+void operator delete(void *pointer) noexcept {
+  free(pointer);
+}
+
+#ifdef __GLIBC__
+extern "C" {
+
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *pointer, size_t size);
+
+void *malloc(size_t size) {
+  g_allocations++;
+  return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+  g_allocations++;
+  return __libc_calloc(count, size);
+}
+
+void *realloc(void *pointer, size_t size) {
+  g_allocations++;
+  return __libc_realloc(pointer, size);
+}
+
+}  // extern "C"
+#endif
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    fprintf(stderr, "usage: %s <dictionary directory> <language>\n", argv[0]);
+    return 1;
+  }
+
+  HunspellSpellchecker spellchecker;
+  if (!spellchecker.SetDictionary(argv[2], argv[1])) {
+    fprintf(stderr, "cannot load the %s dictionary from %s\n", argv[2], argv[1]);
+    return 1;
+  }
+
+  std::vector<uint16_t> text = MakeText();
+  size_t words = CountWords(text);
+
+  std::unique_ptr<SpellcheckerThreadView> view = spellchecker.CreateThreadView();
+  std::vector<MisspelledRange> ranges;
+
+  // The first check sizes the ranges and the view's transcoders.
+  view->CheckSpelling(text.data(), text.size(), &ranges);
+
+  size_t allocations = g_allocations;
+  auto start = std::chrono::steady_clock::now();
+
+  for (int round = 0; round < kRounds; round++) {
+    view->CheckSpelling(text.data(), text.size(), &ranges);
+  }
+
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  allocations = g_allocations - allocations;
+
+  double seconds = std::chrono::duration<double>(elapsed).count();
+  double checked = static_cast<double>(words) * kRounds;
+
+  printf("words checked:        %.0f\n", checked);
+  printf("misspelled per text:  %zu\n", ranges.size());
+  printf("nanoseconds per word: %.1f\n", seconds * 1e9 / checked);
+  printf("allocations per word: %.4f\n", allocations / checked);
+
+  return 0;
+}
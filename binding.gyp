@@ -1,5 +1,6 @@
 {
   'variables': {
+    'spellchecker_benchmark%': 'false',
     'conditions': [
       ['OS=="mac"', {
         'spellchecker_use_hunspell%': 'true',
@@ -36,7 +37,12 @@
       'include_dirs': [ '<!(node -e "require(\'nan\')")' ],
       'sources': [
         'src/main.cc',
-        'src/worker.cc'
+        'src/worker.cc',
+        'src/document_session.cc',
+        'src/ascii.cc',
+        'src/code_page.cc',
+        'src/markup_scanner.cc',
+        'src/ignore_patterns.cc',
       ],
       'conditions': [
         ['spellchecker_use_hunspell=="true"', {
@@ -45,24 +51,33 @@
           ],
           'sources': [
             'src/spellchecker_hunspell.cc',
+            'src/hunspell_dictionary.cc',
+            'src/word_segmenter.cc',
+            'src/word_characters.cc',
+            'src/verdict_cache.cc',
+            'src/suggestion_cache.cc',
+            'src/surface_forms.cc',
           ],
         }],
         ['OS=="win"', {
           'sources': [
              'src/spellchecker_win.cc',
              'src/transcoder_win.cc',
+             'src/mapped_file_win.cc',
           ],
         }],
         ['OS=="linux"', {
           'sources': [
              'src/spellchecker_linux.cc',
              'src/transcoder_posix.cc',
+             'src/mapped_file_posix.cc',
           ],
         }],
         ['OS=="mac"', {
           'sources': [
             'src/spellchecker_mac.mm',
             'src/transcoder_posix.cc',
+            'src/mapped_file_posix.cc',
           ],
           'link_settings': {
             'libraries': [
@@ -125,5 +140,35 @@
         }
       ],
     }],
+    ['spellchecker_use_hunspell=="true" and spellchecker_benchmark=="true" and OS!="win"', {
+      'targets': [
+        {
+          'target_name': 'spellchecker_benchmark',
+          'type': 'executable',
+          'dependencies': [
+            'hunspell',
+          ],
+          'sources': [
+            'benchmark/check_spelling_benchmark.cc',
+            'src/spellchecker_hunspell.cc',
+            'src/hunspell_dictionary.cc',
+            'src/word_segmenter.cc',
+            'src/word_characters.cc',
+            'src/verdict_cache.cc',
+            'src/suggestion_cache.cc',
+            'src/surface_forms.cc',
+            'src/ascii.cc',
+            'src/code_page.cc',
+            'src/markup_scanner.cc',
+            'src/ignore_patterns.cc',
+            'src/transcoder_posix.cc',
+            'src/mapped_file_posix.cc',
+          ],
+          'libraries': [
+            '-luv',
+          ],
+        }
+      ],
+    }],
   ],
 }
@@ -5,8 +5,11 @@ var bindings = require('../build/Release/spellchecker.node');
 var Spellchecker = bindings.Spellchecker;
 
 var checkSpellingAsyncCb = Spellchecker.prototype.checkSpellingAsync
+var getCorrectionsForMisspellingAsyncCb = Spellchecker.prototype.getCorrectionsForMisspellingAsync
+var isMisspelledBatchAsyncCb = Spellchecker.prototype.isMisspelledBatchAsync
+var setDictionaryAsyncCb = Spellchecker.prototype.setDictionaryAsync
 
-Spellchecker.prototype.checkSpellingAsync = function (corpus) {
+Spellchecker.prototype.checkSpellingAsync = function (corpus, options) {
   return new Promise(function (resolve, reject) {
     checkSpellingAsyncCb.call(this, corpus, function (err, result) {
       if (err) {
@@ -14,10 +17,55 @@ Spellchecker.prototype.checkSpellingAsync = function (corpus) {
       } else {
         resolve(result);
       }
+    }, options);
+  }.bind(this));
+};
+
+Spellchecker.prototype.getCorrectionsForMisspellingAsync = function (words, options) {
+  return new Promise(function (resolve, reject) {
+    getCorrectionsForMisspellingAsyncCb.call(this, words, function (err, result) {
+      if (err) {
+        reject(err);
+      } else {
+        resolve(result);
+      }
+    }, options);
+  }.bind(this));
+};
+
+Spellchecker.prototype.isMisspelledBatchAsync = function (words) {
+  return new Promise(function (resolve, reject) {
+    isMisspelledBatchAsyncCb.call(this, words, function (err, result) {
+      if (err) {
+        reject(err);
+      } else {
+        resolve(result);
+      }
     });
   }.bind(this));
 };
 
+Spellchecker.prototype.setDictionaryAsync = function (lang, dictPath) {
+  // Dictionaries are set in the order they were asked for, so the last one
+  // asked for is the one left set.
+  var previous = this._settingDictionary || Promise.resolve();
+
+  var setting = previous.then(function () {
+    return new Promise(function (resolve, reject) {
+      setDictionaryAsyncCb.call(this, lang, dictPath, function (err, result) {
+        if (err) {
+          reject(err);
+        } else {
+          resolve(result);
+        }
+      });
+    }.bind(this));
+  }.bind(this));
+
+  this._settingDictionary = setting.catch(function () {});
+  return setting;
+};
+
 var defaultSpellcheck = null;
 
 var ensureDefaultSpellCheck = function() {
@@ -37,12 +85,55 @@ var setDictionary = function(lang, dictPath) {
   return defaultSpellcheck.setDictionary(lang, dictPath);
 };
 
+var setDictionaryAsync = function(lang, dictPath) {
+  // Load the dictionary of the environment first, so the checks made while
+  // the new one loads have a dictionary to go to.
+  var created = !defaultSpellcheck;
+  ensureDefaultSpellCheck();
+
+  var spellcheck = defaultSpellcheck;
+  var reset = function() {
+    // A spellchecker that never got the dictionary asked for is dropped, so
+    // the next call sets one up again.
+    if (created && defaultSpellcheck === spellcheck) {
+      defaultSpellcheck = null;
+    }
+  };
+
+  return spellcheck.setDictionaryAsync(lang, dictPath).then(function(result) {
+    if (!result) {
+      reset();
+    }
+    return result;
+  }, function(error) {
+    reset();
+    throw error;
+  });
+};
+
+var compileDictionary = function(lang, dictPath) {
+  ensureDefaultSpellCheck();
+  return defaultSpellcheck.compileDictionary(lang, dictPath);
+};
+
 var isMisspelled = function() {
   ensureDefaultSpellCheck();
 
   return defaultSpellcheck.isMisspelled.apply(defaultSpellcheck, arguments);
 };
 
+var isMisspelledBatch = function() {
+  ensureDefaultSpellCheck();
+
+  return defaultSpellcheck.isMisspelledBatch.apply(defaultSpellcheck, arguments);
+};
+
+var isMisspelledBatchAsync = function() {
+  ensureDefaultSpellCheck();
+
+  return defaultSpellcheck.isMisspelledBatchAsync.apply(defaultSpellcheck, arguments);
+};
+
 var checkSpelling = function() {
   ensureDefaultSpellCheck();
 
@@ -67,12 +158,48 @@ var remove = function() {
   defaultSpellcheck.remove.apply(defaultSpellcheck, arguments);
 };
 
+var addWords = function() {
+  ensureDefaultSpellCheck();
+
+  defaultSpellcheck.addWords.apply(defaultSpellcheck, arguments);
+};
+
+var removeWords = function() {
+  ensureDefaultSpellCheck();
+
+  defaultSpellcheck.removeWords.apply(defaultSpellcheck, arguments);
+};
+
+var setPersonalDictionary = function() {
+  ensureDefaultSpellCheck();
+
+  return defaultSpellcheck.setPersonalDictionary.apply(defaultSpellcheck, arguments);
+};
+
+var setIgnorePatterns = function() {
+  ensureDefaultSpellCheck();
+
+  return defaultSpellcheck.setIgnorePatterns.apply(defaultSpellcheck, arguments);
+};
+
 var getCorrectionsForMisspelling = function() {
   ensureDefaultSpellCheck();
 
   return defaultSpellcheck.getCorrectionsForMisspelling.apply(defaultSpellcheck, arguments);
 };
 
+var getCorrectionsForMisspellingAsync = function() {
+  ensureDefaultSpellCheck();
+
+  return defaultSpellcheck.getCorrectionsForMisspellingAsync.apply(defaultSpellcheck, arguments);
+};
+
+var getCacheStats = function() {
+  ensureDefaultSpellCheck();
+
+  return defaultSpellcheck.getCacheStats.apply(defaultSpellcheck, arguments);
+};
+
 var getAvailableDictionaries = function() {
   ensureDefaultSpellCheck();
 
@@ -95,15 +222,26 @@ var getDictionaryPath = function() {
 
 module.exports = {
   setDictionary: setDictionary,
+  setDictionaryAsync: setDictionaryAsync,
+  compileDictionary: compileDictionary,
   add: add,
   remove: remove,
+  addWords: addWords,
+  removeWords: removeWords,
+  setPersonalDictionary: setPersonalDictionary,
+  setIgnorePatterns: setIgnorePatterns,
   isMisspelled: isMisspelled,
+  isMisspelledBatch: isMisspelledBatch,
+  isMisspelledBatchAsync: isMisspelledBatchAsync,
   checkSpelling: checkSpelling,
   checkSpellingAsync: checkSpellingAsync,
   getAvailableDictionaries: getAvailableDictionaries,
   getCorrectionsForMisspelling: getCorrectionsForMisspelling,
+  getCorrectionsForMisspellingAsync: getCorrectionsForMisspellingAsync,
+  getCacheStats: getCacheStats,
   getDictionaryPath: getDictionaryPath,
   Spellchecker: Spellchecker,
+  DocumentSession: bindings.DocumentSession,
   USE_SYSTEM_DEFAULTS: 0,
   ALWAYS_USE_SYSTEM: 1,
   ALWAYS_USE_HUNSPELL: 2,
@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+# Generates src/word_characters.cc, the tables of character types the word
+# segmenter uses, from the Unicode data of the running Python:
+#
+#   python3 script/generate-word-characters.py > src/word_characters.cc
+
+import sys
+import unicodedata
+
+LETTER = 'WORD_CHARACTER_LETTER'
+EXTEND = 'WORD_CHARACTER_EXTEND'
+SEPARATOR = 'WORD_CHARACTER_SEPARATOR'
+
+
+def character_type(code_point):
+    if code_point == 0 or 0x09 <= code_point <= 0x0D or code_point == 0x85:
+        # Control characters are neither, except for the end of the string
+        # and the ones that are whitespace.
+        return SEPARATOR
+    if code_point == 0x200B:
+        # The zero width space is a break between words, not a format character.
+        return SEPARATOR
+
+    category = unicodedata.category(chr(code_point))
+    if category[0] == 'L' or category == 'Nl':
+        return LETTER
+    if category[0] == 'M' or category == 'Cf':
+        return EXTEND
+    if category[0] in 'PSZ' or category in ('No', 'Co'):
+        return SEPARATOR
+    return None
+
+
+def ranges():
+    first = None
+    previous = None
+    for code_point in range(0x100, sys.maxunicode + 1):
+        current = character_type(code_point)
+        if current != previous:
+            if previous:
+                yield first, code_point - 1, previous
+            first = code_point
+            previous = current
+    if previous:
+        yield first, sys.maxunicode, previous
+
+
+def main():
+    table = list(ranges())
+    short_names = {LETTER: 'L', EXTEND: 'E', SEPARATOR: 'S', None: 'O'}
+    latin1 = [short_names[character_type(code_point)] for code_point in range(0x100)]
+
+    print('// Generated by script/generate-word-characters.py from Unicode %s. Do not edit.' % unicodedata.unidata_version)
+    print('')
+    print('#include "word_segmenter.h"')
+    print('')
+    print('namespace spellchecker {')
+    print('')
+    print('#define O WORD_CHARACTER_OTHER')
+    print('#define L %s' % LETTER)
+    print('#define E %s' % EXTEND)
+    print('#define S %s' % SEPARATOR)
+    print('')
+    print('const uint8_t kLatin1WordCharacters[256] = {')
+    for code_point in range(0, 0x100, 16):
+        print('  ' + ' '.join('%s,' % kind for kind in latin1[code_point:code_point + 16]) + '  // %02X' % code_point)
+    print('};')
+    print('')
+    print('#undef O')
+    print('#undef L')
+    print('#undef E')
+    print('#undef S')
+    print('')
+    print('const WordCharacterRange kWordCharacterRanges[] = {')
+    for first, last, kind in table:
+        print('  {0x%04X, 0x%04X, %s},' % (first, last, kind))
+    print('};')
+    print('')
+    print('const size_t kWordCharacterRangeCount = sizeof(kWordCharacterRanges) / sizeof(kWordCharacterRanges[0]);')
+    print('')
+    print('}  // namespace spellchecker')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,153 @@
+#include "ascii.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SPELLCHECKER_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define SPELLCHECKER_NEON
+#include <arm_neon.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace spellchecker {
+
+namespace {
+
+bool IsASCIILetter(uint16_t c) {
+  return static_cast<uint16_t>((c | 0x20) - 'a') < 26;
+}
+
+#ifdef SPELLCHECKER_SSE2
+unsigned int CountTrailingZeros(unsigned int mask) {
+#ifdef _MSC_VER
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return index;
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+#endif
+
+}  // namespace
+
+size_t SkipASCIILetters(const uint16_t *text, size_t position, size_t length) {
+#if defined(SPELLCHECKER_SSE2)
+  // Lowercase the units and offset them by 'a', so letters become 0 to 25.
+  // SSE2 only compares signed numbers, so flip the sign bits to compare them
+  // unsigned.
+  const __m128i lower = _mm_set1_epi16(0x20);
+  const __m128i offset = _mm_set1_epi16(static_cast<short>('a' ^ 0x8000));
+  const __m128i limit = _mm_set1_epi16(static_cast<short>(26 ^ 0x8000));
+
+  for (; position + 8 <= length; position += 8) {
+    __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text + position));
+    __m128i letters = _mm_cmplt_epi16(_mm_sub_epi16(_mm_or_si128(units, lower), offset), limit);
+
+    // Two bits for each unit, set for the letters.
+    unsigned int others = ~_mm_movemask_epi8(letters) & 0xFFFF;
+    if (others) {
+      return position + CountTrailingZeros(others) / 2;
+    }
+  }
+#elif defined(SPELLCHECKER_NEON)
+  const uint16x8_t lower = vdupq_n_u16(0x20);
+  const uint16x8_t offset = vdupq_n_u16('a');
+  const uint16x8_t limit = vdupq_n_u16(26);
+
+  for (; position + 8 <= length; position += 8) {
+    uint16x8_t units = vld1q_u16(text + position);
+    uint16x8_t letters = vcltq_u16(vsubq_u16(vorrq_u16(units, lower), offset), limit);
+
+    // Stop at the block with another character and find it one at a time.
+    if (vminvq_u16(letters) == 0) {
+      break;
+    }
+  }
+#endif
+
+  while (position < length && IsASCIILetter(text[position])) {
+    position++;
+  }
+
+  return position;
+}
+
+size_t SkipASCIILetters(const char *text, size_t position, size_t length) {
+#if defined(SPELLCHECKER_SSE2)
+  const __m128i lower = _mm_set1_epi8(0x20);
+  const __m128i offset = _mm_set1_epi8(static_cast<char>('a' ^ 0x80));
+  const __m128i limit = _mm_set1_epi8(static_cast<char>(26 ^ 0x80));
+
+  for (; position + 16 <= length; position += 16) {
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text + position));
+    __m128i letters = _mm_cmplt_epi8(_mm_sub_epi8(_mm_or_si128(bytes, lower), offset), limit);
+
+    // One bit for each byte, set for the letters.
+    unsigned int others = ~_mm_movemask_epi8(letters) & 0xFFFF;
+    if (others) {
+      return position + CountTrailingZeros(others);
+    }
+  }
+#elif defined(SPELLCHECKER_NEON)
+  const uint8x16_t lower = vdupq_n_u8(0x20);
+  const uint8x16_t offset = vdupq_n_u8('a');
+  const uint8x16_t limit = vdupq_n_u8(26);
+
+  for (; position + 16 <= length; position += 16) {
+    uint8x16_t bytes = vld1q_u8(reinterpret_cast<const uint8_t *>(text + position));
+    uint8x16_t letters = vcltq_u8(vsubq_u8(vorrq_u8(bytes, lower), offset), limit);
+
+    if (vminvq_u8(letters) == 0) {
+      break;
+    }
+  }
+#endif
+
+  while (position < length && IsASCIILetter(static_cast<unsigned char>(text[position]))) {
+    position++;
+  }
+
+  return position;
+}
+
+bool NarrowASCII(char *out, const uint16_t *in, size_t length) {
+  size_t i = 0;
+
+#if defined(SPELLCHECKER_SSE2)
+  const __m128i nonASCII = _mm_set1_epi16(static_cast<short>(0xFF80));
+
+  for (; i + 8 <= length; i += 8) {
+    __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, nonASCII), _mm_setzero_si128())) != 0xFFFF) {
+      return false;
+    }
+
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(out + i), _mm_packus_epi16(units, units));
+  }
+#elif defined(SPELLCHECKER_NEON)
+  for (; i + 8 <= length; i += 8) {
+    uint16x8_t units = vld1q_u16(in + i);
+    if (vmaxvq_u16(units) >= 0x80) {
+      return false;
+    }
+
+    vst1_u8(reinterpret_cast<uint8_t *>(out + i), vmovn_u16(units));
+  }
+#endif
+
+  for (; i < length; i++) {
+    if (in[i] >= 0x80) {
+      return false;
+    }
+
+    out[i] = static_cast<char>(in[i]);
+  }
+
+  return true;
+}
+
+}  // namespace spellchecker
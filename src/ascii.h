@@ -0,0 +1,26 @@
+#ifndef SRC_ASCII_H_
+#define SRC_ASCII_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+
+namespace spellchecker {
+
+// Fast paths for the ASCII text most checks are made on. They go through
+// the text 16 bytes at a time with SSE2 or NEON where the target has them,
+// and one unit at a time otherwise, with the same results.
+
+// Returns the position of the first unit from position on that is not an
+// ASCII letter, or length if there is none.
+size_t SkipASCIILetters(const uint16_t *text, size_t position, size_t length);
+
+// The same for Latin-1 or UTF-8 text, whose ASCII letters are single bytes.
+size_t SkipASCIILetters(const char *text, size_t position, size_t length);
+
+// Copies UTF-16 text into out as ASCII, which is also UTF-8, if it is all
+// ASCII. Returns false, with out undefined, if it is not.
+bool NarrowASCII(char *out, const uint16_t *in, size_t length);
+
+}  // namespace spellchecker
+
+#endif  // SRC_ASCII_H_
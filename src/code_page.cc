@@ -0,0 +1,347 @@
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "code_page.h"
+#include "ascii.h"
+
+namespace spellchecker {
+
+struct CodePage {
+  uint32_t characters[256];
+
+  // The mapped characters with their bytes, sorted by character.
+  std::vector<std::pair<uint32_t, uint8_t> > bytes;
+
+  // Whether the bytes of ASCII characters are the characters themselves, as
+  // in nearly every code page, so ASCII can be copied.
+  bool asciiCompatible;
+};
+
+namespace {
+
+// Reads a character of UTF-8, rejecting the malformed sequences iconv does:
+// truncated or overlong sequences, surrogates and characters past U+10FFFF.
+// Returns the number of bytes read, or 0 if the sequence is malformed.
+size_t ReadUTF8(const unsigned char *in, size_t in_length, uint32_t *c) {
+  unsigned char lead = in[0];
+  size_t length;
+  uint32_t minimum;
+
+  if (lead < 0x80) {
+    *c = lead;
+    return 1;
+  } else if (lead >= 0xC2 && lead <= 0xDF) {
+    length = 2;
+    minimum = 0x80;
+    *c = lead & 0x1F;
+  } else if (lead >= 0xE0 && lead <= 0xEF) {
+    length = 3;
+    minimum = 0x800;
+    *c = lead & 0x0F;
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    length = 4;
+    minimum = 0x10000;
+    *c = lead & 0x07;
+  } else {
+    return 0;
+  }
+
+  if (length > in_length) {
+    return 0;
+  }
+
+  for (size_t i = 1; i < length; i++) {
+    if ((in[i] & 0xC0) != 0x80) {
+      return 0;
+    }
+
+    *c = (*c << 6) | (in[i] & 0x3F);
+  }
+
+  if (*c < minimum || *c > 0x10FFFF || (*c >= 0xD800 && *c <= 0xDFFF)) {
+    return 0;
+  }
+
+  return length;
+}
+
+// Writes a character as UTF-8 if it fits, and returns its length, or 0.
+size_t WriteUTF8(uint32_t c, char *out, size_t space) {
+  size_t length = c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 ? 3 : 4;
+  if (length > space) {
+    return 0;
+  }
+
+  switch (length) {
+    case 1:
+      out[0] = static_cast<char>(c);
+      break;
+
+    case 2:
+      out[0] = static_cast<char>(0xC0 | (c >> 6));
+      out[1] = static_cast<char>(0x80 | (c & 0x3F));
+      break;
+
+    case 3:
+      out[0] = static_cast<char>(0xE0 | (c >> 12));
+      out[1] = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+      out[2] = static_cast<char>(0x80 | (c & 0x3F));
+      break;
+
+    default:
+      out[0] = static_cast<char>(0xF0 | (c >> 18));
+      out[1] = static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+      out[2] = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+      out[3] = static_cast<char>(0x80 | (c & 0x3F));
+      break;
+  }
+
+  return length;
+}
+
+bool CompareCharacter(const std::pair<uint32_t, uint8_t>& entry, uint32_t c) {
+  return entry.first < c;
+}
+
+}  // namespace
+
+CodePage *NewCodePage(const uint32_t characters[256]) {
+  CodePage *result = new CodePage();
+  result->asciiCompatible = true;
+
+  for (int byte = 0; byte < 256; byte++) {
+    result->characters[byte] = characters[byte];
+
+    if (byte < 0x80 && characters[byte] != static_cast<uint32_t>(byte)) {
+      result->asciiCompatible = false;
+    }
+
+    if (characters[byte] != CODE_PAGE_UNMAPPED) {
+      result->bytes.push_back(std::make_pair(characters[byte], static_cast<uint8_t>(byte)));
+    }
+  }
+
+  // Where two bytes have the same character, encode it as the first one.
+  std::stable_sort(result->bytes.begin(), result->bytes.end(),
+    [](const std::pair<uint32_t, uint8_t>& a, const std::pair<uint32_t, uint8_t>& b) { return a.first < b.first; });
+
+  return result;
+}
+
+void FreeCodePage(CodePage *code_page) {
+  delete code_page;
+}
+
+bool IsUTF8EncodingName(const char *name) {
+  // Compare only the letters and digits, ignoring case, so "UTF-8", "utf8"
+  // and "UTF_8" are all the same.
+  const char *expected = "utf8";
+
+  for (; *name; name++) {
+    char c = *name;
+    if (c >= 'A' && c <= 'Z') {
+      c += 'a' - 'A';
+    } else if (!((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9'))) {
+      continue;
+    }
+
+    if (c != *expected++) {
+      return false;
+    }
+  }
+
+  return *expected == '\0';
+}
+
+bool EncodeUTF16ToUTF8(char *out, size_t out_length, const uint16_t *in, size_t in_length) {
+  // Most words are ASCII, which only needs narrowing.
+  if (in_length <= out_length && NarrowASCII(out, in, in_length)) {
+    out[in_length] = '\0';
+    return true;
+  }
+
+  size_t written = 0;
+
+  for (size_t i = 0; i < in_length; i++) {
+    uint32_t c = in[i];
+
+    if (c >= 0xD800 && c <= 0xDBFF) {
+      if (i + 1 >= in_length || in[i + 1] < 0xDC00 || in[i + 1] > 0xDFFF) {
+        return false;
+      }
+
+      c = 0x10000 + ((c - 0xD800) << 10) + (in[++i] - 0xDC00);
+    } else if (c >= 0xDC00 && c <= 0xDFFF) {
+      return false;
+    }
+
+    size_t length = WriteUTF8(c, out + written, out_length - written);
+    if (!length) {
+      return false;
+    }
+
+    written += length;
+  }
+
+  out[written] = '\0';
+  return true;
+}
+
+bool EncodeUTF8ToCodePage(const CodePage *code_page, char *out, size_t out_length, const char *in, size_t in_length) {
+  const unsigned char *bytes = reinterpret_cast<const unsigned char *>(in);
+  size_t written = 0;
+
+  for (size_t i = 0; i < in_length;) {
+    if (written == out_length) {
+      return false;
+    }
+
+    if (bytes[i] < 0x80 && code_page->asciiCompatible) {
+      out[written++] = static_cast<char>(bytes[i++]);
+      continue;
+    }
+
+    uint32_t c;
+    size_t length = ReadUTF8(bytes + i, in_length - i, &c);
+    if (!length) {
+      return false;
+    }
+
+    std::vector<std::pair<uint32_t, uint8_t> >::const_iterator entry =
+      std::lower_bound(code_page->bytes.begin(), code_page->bytes.end(), c, CompareCharacter);
+    if (entry == code_page->bytes.end() || entry->first != c) {
+      return false;
+    }
+
+    out[written++] = static_cast<char>(entry->second);
+    i += length;
+  }
+
+  out[written] = '\0';
+  return true;
+}
+
+bool DecodeCodePageToUTF8(const CodePage *code_page, char *out, size_t out_length, const char *in, size_t in_length) {
+  const unsigned char *bytes = reinterpret_cast<const unsigned char *>(in);
+  size_t written = 0;
+
+  for (size_t i = 0; i < in_length; i++) {
+    uint32_t c = code_page->characters[bytes[i]];
+    if (c == CODE_PAGE_UNMAPPED) {
+      return false;
+    }
+
+    size_t length = WriteUTF8(c, out + written, out_length - written);
+    if (!length) {
+      return false;
+    }
+
+    written += length;
+  }
+
+  out[written] = '\0';
+  return true;
+}
+
+bool EncodeLatin1ToUTF8(char *out, size_t out_length, const char *in, size_t in_length) {
+  const unsigned char *bytes = reinterpret_cast<const unsigned char *>(in);
+  size_t written = 0;
+
+  for (size_t i = 0; i < in_length; i++) {
+    size_t length = WriteUTF8(bytes[i], out + written, out_length - written);
+    if (!length) {
+      return false;
+    }
+
+    written += length;
+  }
+
+  out[written] = '\0';
+  return true;
+}
+
+size_t DecodeUTF8Character(const char *in, size_t in_length, uint32_t *c) {
+  const unsigned char *bytes = reinterpret_cast<const unsigned char *>(in);
+  unsigned char lead = bytes[0];
+  size_t length;
+
+  // The bounds of the byte after the lead, which rule out overlong
+  // sequences, surrogates and characters past U+10FFFF.
+  unsigned char lower = 0x80, upper = 0xBF;
+
+  if (lead < 0x80) {
+    *c = lead;
+    return 1;
+  } else if (lead >= 0xC2 && lead <= 0xDF) {
+    length = 2;
+    *c = lead & 0x1F;
+  } else if (lead >= 0xE0 && lead <= 0xEF) {
+    length = 3;
+    *c = lead & 0x0F;
+    lower = lead == 0xE0 ? 0xA0 : 0x80;
+    upper = lead == 0xED ? 0x9F : 0xBF;
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    length = 4;
+    *c = lead & 0x07;
+    lower = lead == 0xF0 ? 0x90 : 0x80;
+    upper = lead == 0xF4 ? 0x8F : 0xBF;
+  } else {
+    *c = 0xFFFD;
+    return 1;
+  }
+
+  for (size_t i = 1; i < length; i++) {
+    // A malformed sequence ends before the first byte that does not fit.
+    if (i >= in_length || bytes[i] < lower || bytes[i] > upper) {
+      *c = 0xFFFD;
+      return i;
+    }
+
+    *c = (*c << 6) | (bytes[i] & 0x3F);
+    lower = 0x80;
+    upper = 0xBF;
+  }
+
+  return length;
+}
+
+size_t CountUTF16Units(const char *in, size_t in_length) {
+  size_t count = 0;
+
+  for (size_t i = 0; i < in_length; count++) {
+    if (static_cast<unsigned char>(in[i]) < 0x80) {
+      i++;
+      continue;
+    }
+
+    uint32_t c;
+    i += DecodeUTF8Character(in + i, in_length - i, &c);
+
+    if (c >= 0x10000) {
+      count++;
+    }
+  }
+
+  return count;
+}
+
+void DecodeLatin1ToUTF16(const char *in, size_t in_length, std::vector<uint16_t> *out) {
+  const unsigned char *bytes = reinterpret_cast<const unsigned char *>(in);
+  out->insert(out->end(), bytes, bytes + in_length);
+}
+
+void DecodeUTF8ToUTF16(const char *in, size_t in_length, std::vector<uint16_t> *out) {
+  for (size_t i = 0; i < in_length;) {
+    uint32_t c;
+    i += DecodeUTF8Character(in + i, in_length - i, &c);
+
+    if (c >= 0x10000) {
+      out->push_back(static_cast<uint16_t>(0xD800 + ((c - 0x10000) >> 10)));
+      out->push_back(static_cast<uint16_t>(0xDC00 + ((c - 0x10000) & 0x3FF)));
+    } else {
+      out->push_back(static_cast<uint16_t>(c));
+    }
+  }
+}
+
+}  // namespace spellchecker
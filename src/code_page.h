@@ -0,0 +1,59 @@
+#ifndef SRC_CODE_PAGE_H_
+#define SRC_CODE_PAGE_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <vector>
+
+// Marks the bytes a code page has no character for.
+#define CODE_PAGE_UNMAPPED 0xFFFFFFFF
+
+namespace spellchecker {
+
+// A single-byte code page, such as the ISO-8859 ones of older Hunspell
+// dictionaries, converted with tables instead of a call to the system for
+// each word.
+struct CodePage;
+
+// Makes a code page from the character of each of its bytes.
+CodePage *NewCodePage(const uint32_t characters[256]);
+
+void FreeCodePage(CodePage *);
+
+// Returns true if the name is one of the ways of spelling UTF-8.
+bool IsUTF8EncodingName(const char *name);
+
+// The conversions write at most out_length bytes and terminate them after
+// that, so out must hold out_length + 1 bytes. They return false if the
+// input is malformed, has a character the output cannot encode, or does not
+// fit, like iconv does.
+
+// Converts UTF-16 to UTF-8.
+bool EncodeUTF16ToUTF8(char *out, size_t out_length, const uint16_t *in, size_t in_length);
+
+// Converts UTF-8 to a code page.
+bool EncodeUTF8ToCodePage(const CodePage *, char *out, size_t out_length, const char *in, size_t in_length);
+
+// Converts a code page to UTF-8.
+bool DecodeCodePageToUTF8(const CodePage *, char *out, size_t out_length, const char *in, size_t in_length);
+
+// Converts Latin-1, the encoding of one-byte JavaScript strings, to UTF-8.
+bool EncodeLatin1ToUTF8(char *out, size_t out_length, const char *in, size_t in_length);
+
+// Unlike the conversions above, the ones below read any UTF-8 the way a
+// JavaScript TextDecoder does, taking each malformed sequence as a U+FFFD.
+
+// Reads the character at the start of UTF-8 text, and returns the number of
+// bytes it takes.
+size_t DecodeUTF8Character(const char *in, size_t in_length, uint32_t *c);
+
+// Returns the number of UTF-16 units UTF-8 text decodes to.
+size_t CountUTF16Units(const char *in, size_t in_length);
+
+// Converts Latin-1 or UTF-8 text to UTF-16, appending it to out.
+void DecodeLatin1ToUTF16(const char *in, size_t in_length, std::vector<uint16_t> *out);
+void DecodeUTF8ToUTF16(const char *in, size_t in_length, std::vector<uint16_t> *out);
+
+}  // namespace spellchecker
+
+#endif  // SRC_CODE_PAGE_H_
@@ -0,0 +1,151 @@
+#include <algorithm>
+#include "document_session.h"
+
+namespace spellchecker {
+
+namespace {
+
+// The room left in the gap when the buffer grows, so that typing does not
+// grow it again at each edit.
+const size_t kMinimumGapLength = 4096;
+
+// Whitespace that no word or ignore pattern match runs across.
+bool IsWordBoundary(uint16_t c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+}  // namespace
+
+DocumentSession::DocumentSession(SpellcheckerImplementation *impl) : impl(impl), gapStart(0), gapEnd(0) {
+}
+
+void DocumentSession::SetText(const uint16_t *text, size_t length) {
+  buffer.assign(text, text + length);
+  buffer.resize(length + kMinimumGapLength);
+  gapStart = length;
+  gapEnd = buffer.size();
+
+  rangesBefore.clear();
+  rangesAfter.clear();
+
+  if (length > 0) {
+    rangesBefore = impl->CheckSpelling(text, length);
+  }
+}
+
+bool DocumentSession::Edit(size_t offset, size_t removed_length, const uint16_t *inserted, size_t inserted_length,
+                           MisspelledRange *checked, std::vector<MisspelledRange> *misspelled) {
+  size_t length = GetLength();
+  if (offset > length || removed_length > length - offset) {
+    return false;
+  }
+
+  // Widen the edit to the whitespace around it, where every word and ignore
+  // pattern match ends.
+  size_t start = offset;
+  while (start > 0 && !IsWordBoundary(At(start - 1))) {
+    start--;
+  }
+
+  size_t end = offset + removed_length;
+  while (end < length && !IsWordBoundary(At(end))) {
+    end++;
+  }
+
+  // Sort the ranges to either side of the span and drop those in it. A range
+  // running across whitespace, which a system spellchecker may find, is
+  // rechecked whole.
+  while (!rangesBefore.empty() && rangesBefore.back().end > start) {
+    MisspelledRange range = rangesBefore.back();
+    rangesBefore.pop_back();
+
+    if (range.start >= end) {
+      MisspelledRange fromEnd = {length - range.start, length - range.end};
+      rangesAfter.push_back(fromEnd);
+    } else {
+      start = std::min(start, range.start);
+      end = std::max(end, range.end);
+    }
+  }
+
+  while (!rangesAfter.empty() && length - rangesAfter.back().start < end) {
+    MisspelledRange range = {length - rangesAfter.back().start, length - rangesAfter.back().end};
+    rangesAfter.pop_back();
+
+    if (range.end <= start) {
+      rangesBefore.push_back(range);
+    } else {
+      start = std::min(start, range.start);
+      end = std::max(end, range.end);
+    }
+  }
+
+  // Replace the text, then put the gap before the span so it can be checked
+  // in place.
+  MoveGap(offset, inserted_length);
+  gapEnd += removed_length;
+  std::copy(inserted, inserted + inserted_length, buffer.begin() + gapStart);
+  gapStart += inserted_length;
+
+  end = end - removed_length + inserted_length;
+  MoveGap(start, 0);
+
+  misspelled->clear();
+  if (end > start) {
+    *misspelled = impl->CheckSpelling(buffer.data() + gapEnd, end - start);
+  }
+
+  for (auto iter = misspelled->begin(); iter != misspelled->end(); ++iter) {
+    iter->start += start;
+    iter->end += start;
+  }
+
+  rangesBefore.insert(rangesBefore.end(), misspelled->begin(), misspelled->end());
+
+  checked->start = start;
+  checked->end = end;
+  return true;
+}
+
+std::vector<MisspelledRange> DocumentSession::GetMisspelledRanges() const {
+  size_t length = GetLength();
+  std::vector<MisspelledRange> result(rangesBefore);
+
+  for (auto iter = rangesAfter.rbegin(); iter != rangesAfter.rend(); ++iter) {
+    MisspelledRange range = {length - iter->start, length - iter->end};
+    result.push_back(range);
+  }
+
+  return result;
+}
+
+size_t DocumentSession::GetLength() const {
+  return buffer.size() - (gapEnd - gapStart);
+}
+
+uint16_t DocumentSession::At(size_t position) const {
+  return position < gapStart ? buffer[position] : buffer[position + (gapEnd - gapStart)];
+}
+
+void DocumentSession::MoveGap(size_t position, size_t space) {
+  if (gapEnd - gapStart < space) {
+    // Grow the buffer and move the text after the gap to its end.
+    size_t after = buffer.size() - gapEnd;
+    buffer.resize(std::max(buffer.size() * 2, GetLength() + space + kMinimumGapLength));
+
+    std::copy_backward(buffer.begin() + gapEnd, buffer.begin() + gapEnd + after, buffer.end());
+    gapEnd = buffer.size() - after;
+  }
+
+  if (position < gapStart) {
+    std::copy_backward(buffer.begin() + position, buffer.begin() + gapStart, buffer.begin() + gapEnd);
+    gapEnd -= gapStart - position;
+    gapStart = position;
+  } else if (position > gapStart) {
+    std::copy(buffer.begin() + gapEnd, buffer.begin() + gapEnd + (position - gapStart), buffer.begin() + gapStart);
+    gapEnd += position - gapStart;
+    gapStart = position;
+  }
+}
+
+}  // namespace spellchecker
@@ -0,0 +1,62 @@
+#ifndef SRC_DOCUMENT_SESSION_H_
+#define SRC_DOCUMENT_SESSION_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <vector>
+#include "spellchecker.h"
+
+namespace spellchecker {
+
+// Keeps the text of a document being edited and its misspelled ranges, so
+// that an edit only rechecks the words around it.
+//
+// The span rechecked runs from the whitespace before the edit to the
+// whitespace after it. Whitespace ends every word and every match of the
+// ignore patterns, which cannot take it in (IgnorePatternSet::Compile
+// rejects those that can), so the words outside the span are the same as
+// before and keep their ranges, moved by the change in length.
+class DocumentSession {
+public:
+  DocumentSession(SpellcheckerImplementation *impl);
+
+  // Replaces the whole text and checks it.
+  void SetText(const uint16_t *text, size_t length);
+
+  // Replaces removed_length units at offset with the inserted text, and
+  // rechecks the words around it. Sets checked to the range of the new text
+  // that was rechecked and misspelled to the ranges found in it, which
+  // replace the previous ones there. Returns false, changing nothing, if the
+  // removed units are past the end of the text.
+  bool Edit(size_t offset, size_t removed_length, const uint16_t *inserted, size_t inserted_length,
+            MisspelledRange *checked, std::vector<MisspelledRange> *misspelled);
+
+  std::vector<MisspelledRange> GetMisspelledRanges() const;
+
+  size_t GetLength() const;
+
+private:
+  uint16_t At(size_t position) const;
+
+  // Moves the gap of the text to a position, with room for at least
+  // space units in it.
+  void MoveGap(size_t position, size_t space);
+
+  SpellcheckerImplementation *impl;
+
+  // The text is kept in a gap buffer, with the gap at the last edit, so an
+  // edit only moves the text between it and the last one.
+  std::vector<uint16_t> buffer;
+  size_t gapStart;
+  size_t gapEnd;
+
+  // The misspelled ranges before the last edit, in order, and those after
+  // it, nearest last. Those after are counted back from the end of the text,
+  // which the edits before them do not change.
+  std::vector<MisspelledRange> rangesBefore;
+  std::vector<MisspelledRange> rangesAfter;
+};
+
+}  // namespace spellchecker
+
+#endif  // SRC_DOCUMENT_SESSION_H_
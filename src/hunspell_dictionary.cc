@@ -0,0 +1,311 @@
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <map>
+#include <vector>
+#include <uv.h>
+#include "../vendor/hunspell/src/hunspell/hunspell.hxx"
+#include "hunspell_dictionary.h"
+#include "mapped_file.h"
+#include "transcoder.h"
+#include "buffers.h"
+#include "lock.h"
+
+// A compiled dictionary is stored next to the .aff and .dic files, with the
+// set of its commonest surface forms.
+#define DICTIONARY_IMAGE_SUFFIX ".dic.bin"
+#define DICTIONARY_IMAGE_MAGIC "SPCKDIC1"
+#define SURFACE_FORMS_IMAGE_SUFFIX ".forms.bin"
+#define SURFACE_FORMS_IMAGE_MAGIC "SPCKFRM1"
+
+namespace spellchecker {
+
+namespace {
+
+// The most surface forms compiled. The shortest are taken, as shorter words
+// tend to be commoner ones.
+const size_t kMaxSurfaceForms = 1 << 18;
+
+// Header of a compiled dictionary: the files it was compiled from, followed
+// by the image of the Hunspell hash table, or of the surface forms.
+struct DictionaryImageHeader {
+  char magic[8];
+  uint64_t aff_size;
+  uint64_t aff_mtime;
+  uint64_t dic_size;
+  uint64_t dic_mtime;
+  uint64_t reserved[3];
+};
+
+bool GetDictionaryImageHeader(const std::string& basepath, const char *magic, DictionaryImageHeader *header) {
+  memset(header, 0, sizeof(DictionaryImageHeader));
+  memcpy(header->magic, magic, sizeof(header->magic));
+
+  return GetFileStamp(basepath + ".aff", &header->aff_size, &header->aff_mtime) &&
+    GetFileStamp(basepath + ".dic", &header->dic_size, &header->dic_mtime);
+}
+
+// Maps a compiled image of the dictionary, if there is one that matches the
+// stamp of the .aff and .dic files.
+MappedFile *OpenDictionaryImage(const std::string& path, const DictionaryImageHeader& expected) {
+  MappedFile *image = NewMappedFile(path);
+  if (!image) {
+    return NULL;
+  }
+
+  if (GetMappedSize(image) < sizeof(DictionaryImageHeader) ||
+      memcmp(GetMappedData(image), &expected, sizeof(DictionaryImageHeader)) != 0) {
+    FreeMappedFile(image);
+    return NULL;
+  }
+
+  return image;
+}
+
+bool WriteDictionaryImage(const std::string& path, const DictionaryImageHeader& header, const char *data, size_t size) {
+  std::vector<char> contents(sizeof(header) + size);
+  memcpy(contents.data(), &header, sizeof(header));
+  memcpy(contents.data() + sizeof(header), data, size);
+
+  return WriteFileAtomically(path, contents.data(), contents.size());
+}
+
+// Builds the image of the set of the commonest surface forms of a
+// dictionary: the forms of its root words with their affixes that Hunspell
+// takes as spelled correctly, in UTF-8.
+bool BuildSurfaceForms(const HashMgr& table, const std::string& affixpath, std::vector<char> *image) {
+  Hunspell hunspell(affixpath.c_str(), &table);
+
+  std::vector<std::string> candidates;
+  struct hentry *hp = NULL;
+  int col = -1;
+  while ((hp = table.walk_hashtable(col, hp)) != NULL) {
+    char **forms;
+    int count = hunspell.expand(&forms, hp);
+
+    for (int i = 0; i < count; i++) {
+      candidates.push_back(forms[i]);
+    }
+
+    hunspell.free_list(&forms, count);
+  }
+
+  std::sort(candidates.begin(), candidates.end(), [](const std::string& a, const std::string& b) {
+    return a.size() != b.size() ? a.size() < b.size() : a < b;
+  });
+  candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+  std::string encoding = hunspell.get_dic_encoding();
+  Transcoder *transcoder = encoding.compare("UTF-8") != 0 ? NewTranscoder8to8(encoding.c_str(), "UTF8") : NULL;
+  char utf8_buffer[MAX_TRANSCODE_BUFFER];
+
+  std::vector<std::string> words;
+  for (auto iter = candidates.begin(); iter != candidates.end() && words.size() < kMaxSurfaceForms; ++iter) {
+    if (iter->size() > MAX_UTF8_BUFFER || !hunspell.spell(iter->c_str()) ||
+        !Transcode8to8(transcoder, utf8_buffer, sizeof(utf8_buffer) - 1, iter->data(), iter->size())) {
+      continue;
+    }
+
+    size_t length = strlen(utf8_buffer);
+    if (length > 0 && length <= 255) {
+      words.push_back(std::string(utf8_buffer, length));
+    }
+  }
+
+  if (transcoder) {
+    FreeTranscoder(transcoder);
+  }
+
+  return SurfaceFormSet::BuildImage(words, image);
+}
+
+}  // namespace
+
+struct HunspellDictionary {
+  std::string basepath;
+  DictionaryImageHeader stamp;
+  int refcount;
+
+  // Set while the files are parsed outside the registry lock. Others asking
+  // for the dictionary wait on g_dictionaryLoaded until it is cleared.
+  bool loading;
+
+  HashMgr *table;
+  MappedFile *image;
+
+  // Empty unless the dictionary has been compiled with its surface forms.
+  SurfaceFormSet forms;
+  MappedFile *formsImage;
+};
+
+namespace {
+
+// The loaded dictionaries by base path. A dictionary whose files changed is
+// replaced here, but stays loaded for the spellcheckers still using it. The
+// mutex only guards the map and the reference counts: dictionaries are
+// parsed without it, so loading one does not hold up the others.
+std::map<std::string, HunspellDictionary *> g_dictionaries;
+uv_mutex_t g_dictionariesMutex;
+uv_cond_t g_dictionaryLoaded;
+uv_once_t g_dictionariesOnce = UV_ONCE_INIT;
+
+void InitDictionariesMutex() {
+  uv_mutex_init(&g_dictionariesMutex);
+  uv_cond_init(&g_dictionaryLoaded);
+}
+
+// Reads the files of a dictionary whose base path and stamp are set.
+void LoadDictionary(HunspellDictionary *dictionary, bool stamped) {
+  const std::string& basepath = dictionary->basepath;
+  std::string affixpath = basepath + ".aff";
+
+  // If the dictionary has been compiled, use its hash table in place from
+  // the mapped image instead of parsing the .dic file.
+  if (stamped) {
+    dictionary->image = OpenDictionaryImage(basepath + DICTIONARY_IMAGE_SUFFIX, dictionary->stamp);
+
+    DictionaryImageHeader formsStamp = dictionary->stamp;
+    memcpy(formsStamp.magic, SURFACE_FORMS_IMAGE_MAGIC, sizeof(formsStamp.magic));
+    dictionary->formsImage = OpenDictionaryImage(basepath + SURFACE_FORMS_IMAGE_SUFFIX, formsStamp);
+  }
+
+  if (dictionary->formsImage && !dictionary->forms.Open(
+        GetMappedData(dictionary->formsImage) + sizeof(DictionaryImageHeader),
+        GetMappedSize(dictionary->formsImage) - sizeof(DictionaryImageHeader))) {
+    FreeMappedFile(dictionary->formsImage);
+    dictionary->formsImage = NULL;
+  }
+
+  if (dictionary->image) {
+    dictionary->table = new HashMgr(
+      GetMappedData(dictionary->image) + sizeof(DictionaryImageHeader),
+      GetMappedSize(dictionary->image) - sizeof(DictionaryImageHeader),
+      affixpath.c_str());
+
+    if (!dictionary->table->is_loaded()) {
+      delete dictionary->table;
+      dictionary->table = NULL;
+      FreeMappedFile(dictionary->image);
+      dictionary->image = NULL;
+    }
+  }
+
+  if (!dictionary->table) {
+    dictionary->table = new HashMgr((basepath + ".dic").c_str(), affixpath.c_str());
+  }
+}
+
+void FreeDictionary(HunspellDictionary *dictionary) {
+  delete dictionary->table;
+
+  if (dictionary->image) {
+    FreeMappedFile(dictionary->image);
+  }
+
+  if (dictionary->formsImage) {
+    FreeMappedFile(dictionary->formsImage);
+  }
+
+  delete dictionary;
+}
+
+}  // namespace
+
+HunspellDictionary *AcquireHunspellDictionary(const std::string& basepath) {
+  DictionaryImageHeader stamp;
+  bool stamped = GetDictionaryImageHeader(basepath, DICTIONARY_IMAGE_MAGIC, &stamp);
+
+  uv_once(&g_dictionariesOnce, InitDictionariesMutex);
+
+  HunspellDictionary *dictionary;
+  {
+    Lock lock(g_dictionariesMutex);
+
+    // Wait for the dictionary if another thread is loading it. It is looked
+    // up again after each wait, as it may have been released meanwhile.
+    std::map<std::string, HunspellDictionary *>::iterator iter;
+    while ((iter = g_dictionaries.find(basepath)) != g_dictionaries.end() && iter->second->loading) {
+      uv_cond_wait(&g_dictionaryLoaded, &g_dictionariesMutex);
+    }
+
+    if (iter != g_dictionaries.end() && memcmp(&iter->second->stamp, &stamp, sizeof(stamp)) == 0) {
+      iter->second->refcount++;
+      return iter->second;
+    }
+
+    dictionary = new HunspellDictionary();
+    dictionary->basepath = basepath;
+    dictionary->stamp = stamp;
+    dictionary->refcount = 1;
+    dictionary->loading = true;
+    dictionary->table = NULL;
+    dictionary->image = NULL;
+    dictionary->formsImage = NULL;
+    g_dictionaries[basepath] = dictionary;
+  }
+
+  LoadDictionary(dictionary, stamped);
+
+  {
+    Lock lock(g_dictionariesMutex);
+    dictionary->loading = false;
+  }
+  uv_cond_broadcast(&g_dictionaryLoaded);
+
+  return dictionary;
+}
+
+void ReleaseHunspellDictionary(HunspellDictionary *dictionary) {
+  uv_once(&g_dictionariesOnce, InitDictionariesMutex);
+  Lock lock(g_dictionariesMutex);
+
+  if (--dictionary->refcount > 0) {
+    return;
+  }
+
+  std::map<std::string, HunspellDictionary *>::iterator iter = g_dictionaries.find(dictionary->basepath);
+  if (iter != g_dictionaries.end() && iter->second == dictionary) {
+    g_dictionaries.erase(iter);
+  }
+
+  FreeDictionary(dictionary);
+}
+
+const HashMgr *GetHunspellDictionaryTable(const HunspellDictionary *dictionary) {
+  return dictionary->table;
+}
+
+const SurfaceFormSet *GetHunspellDictionaryForms(const HunspellDictionary *dictionary) {
+  return dictionary->formsImage ? &dictionary->forms : NULL;
+}
+
+bool CompileHunspellDictionary(const std::string& basepath) {
+  // Stamp the image with the files before reading them, so a dictionary
+  // changed while compiling makes a stale image instead of a wrong one.
+  DictionaryImageHeader header, formsHeader;
+  if (!GetDictionaryImageHeader(basepath, DICTIONARY_IMAGE_MAGIC, &header) ||
+      !GetDictionaryImageHeader(basepath, SURFACE_FORMS_IMAGE_MAGIC, &formsHeader)) {
+    return false;
+  }
+
+  std::string affixpath = basepath + ".aff";
+  HashMgr table((basepath + ".dic").c_str(), affixpath.c_str());
+  if (!table.is_loaded()) {
+    return false;
+  }
+
+  size_t size;
+  char *data = table.build_image(&size);
+  if (!data) {
+    return false;
+  }
+
+  bool written = WriteDictionaryImage(basepath + DICTIONARY_IMAGE_SUFFIX, header, data, size);
+  free(data);
+
+  std::vector<char> forms;
+  return written && BuildSurfaceForms(table, affixpath, &forms) &&
+    WriteDictionaryImage(basepath + SURFACE_FORMS_IMAGE_SUFFIX, formsHeader, forms.data(), forms.size());
+}
+
+}  // namespace spellchecker
@@ -0,0 +1,38 @@
+#ifndef SRC_HUNSPELL_DICTIONARY_H_
+#define SRC_HUNSPELL_DICTIONARY_H_
+
+#include <string>
+#include "surface_forms.h"
+
+class HashMgr;
+
+namespace spellchecker {
+
+// The word list of a Hunspell dictionary. It is loaded once per process and
+// shared read-only by every spellchecker using the same files; the words a
+// spellchecker adds or removes are kept in its own Hunspell object on top of
+// it.
+struct HunspellDictionary;
+
+// Gets the dictionary at `basepath` (the path of the .aff and .dic files
+// without the extension), loading it unless it is already loaded and the
+// files have not changed since.
+HunspellDictionary *AcquireHunspellDictionary(const std::string& basepath);
+
+// Releases a dictionary; it is unloaded with its last reference.
+void ReleaseHunspellDictionary(HunspellDictionary *);
+
+const HashMgr *GetHunspellDictionaryTable(const HunspellDictionary *);
+
+// Gets the commonest surface forms of the dictionary, which Hunspell takes
+// as spelled correctly, or NULL unless the dictionary has been compiled.
+const SurfaceFormSet *GetHunspellDictionaryForms(const HunspellDictionary *);
+
+// Writes the image of the dictionary at `basepath`, which is then mapped by
+// AcquireHunspellDictionary instead of parsing the .dic file, and the image
+// of its commonest surface forms.
+bool CompileHunspellDictionary(const std::string& basepath);
+
+}  // namespace spellchecker
+
+#endif  // SRC_HUNSPELL_DICTIONARY_H_
@@ -0,0 +1,823 @@
+#include <algorithm>
+#include <bitset>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include "ignore_patterns.h"
+
+namespace spellchecker {
+
+namespace {
+
+// Units are matched by class: each ASCII character is its own, and all
+// other characters share the last one.
+const size_t kClassCount = 129;
+const size_t kNonASCIIClass = 128;
+
+// The limits that keep patterns such as (a|b){1000} from taking too long or
+// too much memory to compile.
+const size_t kMaxNFAStates = 20000;
+const size_t kMaxDFAStates = 4096;
+const int kMaxRepeatCount = 1000;
+const int kMaxNestingDepth = 100;
+
+// The longest text a match is looked for in, so that patterns such as
+// "a.*b" cannot make finding matches quadratic.
+const size_t kMaxMatchLength = 4096;
+
+typedef std::bitset<kClassCount> UnitSet;
+
+// URLs do not end in the punctuation of the sentence around them, and
+// hashes are at least 7 hex digits with a digit among them, as words of hex
+// letters alone, such as "defaced", are not hashes.
+const struct {
+  int flag;
+  const char *pattern;
+} kBuiltinPatterns[] = {
+  {IGNORE_URLS,
+    "([A-Za-z][A-Za-z0-9+.-]*://|www\\.)[^\\s\"'<>()\\[\\]{}]*[^\\s\"'<>()\\[\\]{}.,;:!?]"},
+  {IGNORE_EMAILS,
+    "[A-Za-z0-9._%+-]+@[A-Za-z0-9-]+(\\.[A-Za-z0-9-]+)+"},
+  {IGNORE_NUMBERS,
+    "[+-]?[0-9][0-9_]*(\\.[0-9_]+)?([eE][+-]?[0-9]+)?[A-Za-z%]*|0[xX][0-9A-Fa-f_]+"},
+  {IGNORE_VERSIONS,
+    "[vV]?[0-9]+(\\.[0-9]+)+([-+][0-9A-Za-z.-]+)?"},
+  {IGNORE_HASHES,
+    "[0-9][0-9A-Fa-f]{6,}|[A-Fa-f][0-9][0-9A-Fa-f]{5,}|[A-Fa-f]{2}[0-9][0-9A-Fa-f]{4,}|"
+    "[A-Fa-f]{3}[0-9][0-9A-Fa-f]{3,}|[A-Fa-f]{4}[0-9][0-9A-Fa-f]{2,}|[A-Fa-f]{5}[0-9][0-9A-Fa-f]+|"
+    "[A-Fa-f]{6,}[0-9][0-9A-Fa-f]*|[0-9A-Fa-f]{8}(-[0-9A-Fa-f]{4}){3}-[0-9A-Fa-f]{12}"},
+};
+
+bool IsASCIILetter(uint32_t c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+bool IsASCIIDigit(uint32_t c) {
+  return c >= '0' && c <= '9';
+}
+
+UnitSet MakeRange(uint32_t first, uint32_t last) {
+  UnitSet set;
+  for (uint32_t c = first; c <= last; c++) {
+    set.set(c);
+  }
+
+  return set;
+}
+
+UnitSet DigitSet() {
+  return MakeRange('0', '9');
+}
+
+UnitSet WordSet() {
+  return MakeRange('a', 'z') | MakeRange('A', 'Z') | MakeRange('0', '9') | MakeRange('_', '_');
+}
+
+UnitSet SpaceSet() {
+  return MakeRange('\t', '\r') | MakeRange(' ', ' ');
+}
+
+// A node of the syntax tree of an expression.
+struct Node {
+  enum Kind {
+    SET,
+    SEQUENCE,
+    ALTERNATIVES,
+    REPEAT,
+  };
+
+  Kind kind;
+  UnitSet set;
+  std::vector<size_t> children;
+
+  // The counts of a repeat, max being -1 when there is no limit.
+  int min;
+  int max;
+};
+
+// Parses an expression into nodes.
+class PatternParser {
+public:
+  PatternParser(const std::string& pattern, std::vector<Node> *nodes)
+    : pattern(pattern), position(0), ignoreCase(false), tooLarge(false), depth(0), nodes(nodes)
+  {
+    //
+  }
+
+  bool Parse(size_t *root)
+  {
+    if (pattern.compare(0, 4, "(?i)") == 0) {
+      ignoreCase = true;
+      position = 4;
+    }
+
+    return ParseAlternatives(root) && position == pattern.size() && !tooLarge;
+  }
+
+private:
+  bool AtEnd() const
+  {
+    return position >= pattern.size();
+  }
+
+  uint32_t Peek() const
+  {
+    return static_cast<unsigned char>(pattern[position]);
+  }
+
+  size_t AddNode(Node::Kind kind)
+  {
+    Node node;
+    node.kind = kind;
+    node.min = node.max = 0;
+    nodes->push_back(node);
+    return nodes->size() - 1;
+  }
+
+  size_t AddSet(UnitSet set)
+  {
+    if (ignoreCase) {
+      for (uint32_t c = 'a'; c <= 'z'; c++) {
+        if (set[c] || set[c - 'a' + 'A']) {
+          set.set(c);
+          set.set(c - 'a' + 'A');
+        }
+      }
+    }
+
+    size_t node = AddNode(Node::SET);
+    (*nodes)[node].set = set;
+    return node;
+  }
+
+  bool ParseAlternatives(size_t *result)
+  {
+    if (++depth > kMaxNestingDepth) {
+      return false;
+    }
+
+    size_t node = AddNode(Node::ALTERNATIVES);
+    for (;;) {
+      size_t sequence;
+      if (!ParseSequence(&sequence)) {
+        return false;
+      }
+
+      (*nodes)[node].children.push_back(sequence);
+      if (AtEnd() || Peek() != '|') {
+        break;
+      }
+
+      position++;
+    }
+
+    depth--;
+    *result = node;
+    return true;
+  }
+
+  bool ParseSequence(size_t *result)
+  {
+    size_t node = AddNode(Node::SEQUENCE);
+    while (!AtEnd() && Peek() != '|' && Peek() != ')') {
+      size_t atom;
+      if (!ParseAtom(&atom) || !ParseQuantifier(&atom)) {
+        return false;
+      }
+
+      (*nodes)[node].children.push_back(atom);
+    }
+
+    *result = node;
+    return true;
+  }
+
+  // Reads the quantifier after an atom, if any. A quantifier after another
+  // is left to fail as an atom, as in JavaScript.
+  bool ParseQuantifier(size_t *atom)
+  {
+    if (AtEnd()) {
+      return true;
+    }
+
+    int min, max;
+    uint32_t c = Peek();
+
+    if (c == '*') {
+      min = 0;
+      max = -1;
+      position++;
+    } else if (c == '+') {
+      min = 1;
+      max = -1;
+      position++;
+    } else if (c == '?') {
+      min = 0;
+      max = 1;
+      position++;
+    } else if (c != '{' || !ParseCounts(&min, &max)) {
+      return true;
+    }
+
+    // Lazy quantifiers match the same text, as the longest match is taken.
+    if (!AtEnd() && Peek() == '?') {
+      position++;
+    }
+
+    size_t node = AddNode(Node::REPEAT);
+    (*nodes)[node].children.push_back(*atom);
+    (*nodes)[node].min = min;
+    (*nodes)[node].max = max;
+    *atom = node;
+    return true;
+  }
+
+  // Reads {n}, {n,} or {n,m}, leaving the position as it was if there is no
+  // such quantifier, as a brace is then a character of its own.
+  bool ParseCounts(int *min, int *max)
+  {
+    size_t start = position++;
+    if (!ParseCount(min)) {
+      position = start;
+      return false;
+    }
+
+    *max = *min;
+    if (!AtEnd() && Peek() == ',') {
+      position++;
+      *max = -1;
+      if (!AtEnd() && IsASCIIDigit(Peek()) && !ParseCount(max)) {
+        position = start;
+        return false;
+      }
+    }
+
+    if (AtEnd() || Peek() != '}') {
+      position = start;
+      return false;
+    }
+
+    position++;
+    return true;
+  }
+
+  bool ParseCount(int *value)
+  {
+    if (AtEnd() || !IsASCIIDigit(Peek())) {
+      return false;
+    }
+
+    *value = 0;
+    while (!AtEnd() && IsASCIIDigit(Peek())) {
+      *value = std::min(*value * 10 + static_cast<int>(Peek() - '0'), kMaxRepeatCount + 1);
+      position++;
+    }
+
+    tooLarge = tooLarge || *value > kMaxRepeatCount;
+    return true;
+  }
+
+  bool ParseAtom(size_t *result)
+  {
+    uint32_t c = Peek();
+    UnitSet set;
+
+    switch (c) {
+      case '(':
+        position++;
+        if (!AtEnd() && Peek() == '?') {
+          if (pattern.compare(position, 2, "?:") != 0) {
+            return false;
+          }
+
+          position += 2;
+        }
+
+        if (!ParseAlternatives(result) || AtEnd() || Peek() != ')') {
+          return false;
+        }
+
+        position++;
+        return true;
+
+      case '[':
+        position++;
+        if (!ParseClass(&set)) {
+          return false;
+        }
+        break;
+
+      case '.':
+        position++;
+        set.set();
+        set.reset('\n');
+        set.reset('\r');
+        break;
+
+      case '\\':
+        position++;
+        if (!ParseEscape(&set)) {
+          return false;
+        }
+        break;
+
+      case '^':
+      case '$':
+      case '*':
+      case '+':
+      case '?':
+        return false;
+
+      case '{': {
+        int min, max;
+        if (ParseCounts(&min, &max)) {
+          return false;
+        }
+
+        position++;
+        set.set(c);
+        break;
+      }
+
+      default:
+        set.set(ReadCharacter());
+        break;
+    }
+
+    *result = AddSet(set);
+    return true;
+  }
+
+  // Reads a character of the pattern, any non-ASCII one as its class.
+  uint32_t ReadCharacter()
+  {
+    uint32_t c = Peek();
+    position++;
+
+    if (c < 0x80) {
+      return c;
+    }
+
+    while (!AtEnd() && (Peek() & 0xC0) == 0x80) {
+      position++;
+    }
+
+    return kNonASCIIClass;
+  }
+
+  bool ParseClass(UnitSet *set)
+  {
+    bool negated = !AtEnd() && Peek() == '^';
+    if (negated) {
+      position++;
+    }
+
+    while (!AtEnd() && Peek() != ']') {
+      UnitSet item;
+      uint32_t first = kClassCount;
+
+      if (Peek() == '\\') {
+        position++;
+        if (!ParseEscape(&item)) {
+          return false;
+        }
+
+        if (item.count() == 1) {
+          for (first = 0; !item[first]; first++) {
+          }
+        }
+      } else {
+        first = ReadCharacter();
+        item.set(first);
+      }
+
+      // A dash between two characters makes a range of them.
+      if (first < kNonASCIIClass && position + 1 < pattern.size() && Peek() == '-' && pattern[position + 1] != ']') {
+        position++;
+
+        UnitSet last;
+        if (Peek() == '\\') {
+          position++;
+          if (!ParseEscape(&last) || last.count() != 1) {
+            return false;
+          }
+        } else {
+          last.set(ReadCharacter());
+        }
+
+        uint32_t end;
+        for (end = 0; !last[end]; end++) {
+        }
+
+        if (end < first) {
+          return false;
+        }
+
+        // A range up to a non-ASCII character takes in all of them.
+        item = MakeRange(first, end);
+      }
+
+      *set |= item;
+    }
+
+    if (AtEnd()) {
+      return false;
+    }
+
+    position++;
+    if (negated) {
+      set->flip();
+    }
+
+    return true;
+  }
+
+  bool ParseEscape(UnitSet *set)
+  {
+    if (AtEnd()) {
+      return false;
+    }
+
+    uint32_t c = Peek();
+    position++;
+
+    switch (c) {
+      case 'd': *set = DigitSet(); break;
+      case 'D': *set = ~DigitSet(); break;
+      case 'w': *set = WordSet(); break;
+      case 'W': *set = ~WordSet(); break;
+      case 's': *set = SpaceSet(); break;
+      case 'S': *set = ~SpaceSet(); break;
+      case 't': set->set('\t'); break;
+      case 'n': set->set('\n'); break;
+      case 'r': set->set('\r'); break;
+      case 'f': set->set('\f'); break;
+      case 'v': set->set('\v'); break;
+
+      case 'x':
+      case 'u': {
+        size_t digits = c == 'x' ? 2 : 4;
+        if (position + digits > pattern.size()) {
+          return false;
+        }
+
+        uint32_t value = static_cast<uint32_t>(strtoul(pattern.substr(position, digits).c_str(), NULL, 16));
+        for (size_t i = 0; i < digits; i++) {
+          if (!isxdigit(static_cast<unsigned char>(pattern[position + i]))) {
+            return false;
+          }
+        }
+
+        position += digits;
+        set->set(value < 0x80 ? value : kNonASCIIClass);
+        break;
+      }
+
+      default:
+        // Word boundaries, back references and the like are not supported,
+        // while other escaped characters stand for themselves.
+        if (c >= 0x80 || IsASCIILetter(c) || IsASCIIDigit(c)) {
+          return false;
+        }
+
+        set->set(c);
+        break;
+    }
+
+    return true;
+  }
+
+  const std::string& pattern;
+  size_t position;
+  bool ignoreCase;
+
+  // Set when a count is over kMaxRepeatCount.
+  bool tooLarge;
+
+  int depth;
+  std::vector<Node> *nodes;
+};
+
+// A state of the NFA the nodes are compiled to.
+struct NFAState {
+  enum Kind {
+    SET,
+    SPLIT,
+    MATCH,
+  };
+
+  Kind kind;
+  UnitSet set;
+  int out;
+  int out1;
+};
+
+int AddState(std::vector<NFAState> *states, NFAState::Kind kind, int out, int out1)
+{
+  if (states->size() >= kMaxNFAStates) {
+    return -1;
+  }
+
+  NFAState state;
+  state.kind = kind;
+  state.out = out;
+  state.out1 = out1;
+  states->push_back(state);
+  return static_cast<int>(states->size() - 1);
+}
+
+// Compiles a node into states that go on to next when it has matched, and
+// returns the first of them, or -1 if there are too many states.
+int BuildStates(const std::vector<Node>& nodes, size_t index, int next, std::vector<NFAState> *states)
+{
+  const Node& node = nodes[index];
+
+  switch (node.kind) {
+    case Node::SET: {
+      int state = AddState(states, NFAState::SET, next, -1);
+      if (state >= 0) {
+        (*states)[state].set = node.set;
+      }
+      return state;
+    }
+
+    case Node::SEQUENCE:
+      for (size_t i = node.children.size(); i > 0 && next >= 0; i--) {
+        next = BuildStates(nodes, node.children[i - 1], next, states);
+      }
+      return next;
+
+    case Node::ALTERNATIVES: {
+      int first = BuildStates(nodes, node.children.back(), next, states);
+      for (size_t i = node.children.size() - 1; i > 0 && first >= 0; i--) {
+        int alternative = BuildStates(nodes, node.children[i - 1], next, states);
+        first = alternative >= 0 ? AddState(states, NFAState::SPLIT, alternative, first) : -1;
+      }
+      return first;
+    }
+
+    case Node::REPEAT: {
+      if (node.max >= 0 && node.max < node.min) {
+        return -1;
+      }
+
+      int first = next;
+      if (node.max < 0) {
+        int loop = AddState(states, NFAState::SPLIT, -1, next);
+        int body = loop >= 0 ? BuildStates(nodes, node.children[0], loop, states) : -1;
+        if (body < 0) {
+          return -1;
+        }
+
+        (*states)[loop].out = body;
+        first = loop;
+      } else {
+        for (int i = node.min; i < node.max && first >= 0; i++) {
+          int body = BuildStates(nodes, node.children[0], first, states);
+          first = body >= 0 ? AddState(states, NFAState::SPLIT, body, next) : -1;
+        }
+      }
+
+      for (int i = 0; i < node.min && first >= 0; i++) {
+        first = BuildStates(nodes, node.children[0], first, states);
+      }
+      return first;
+    }
+  }
+
+  return -1;
+}
+
+// Collects the states reached from some states without reading a unit, the
+// sets and matches among them being a state of the DFA.
+std::vector<int> GetClosure(const std::vector<NFAState>& states, std::vector<int> pending)
+{
+  std::vector<int> closure;
+  std::vector<uint8_t> seen(states.size());
+
+  while (!pending.empty()) {
+    int index = pending.back();
+    pending.pop_back();
+
+    if (index < 0 || seen[index]) {
+      continue;
+    }
+
+    seen[index] = 1;
+    if (states[index].kind == NFAState::SPLIT) {
+      pending.push_back(states[index].out);
+      pending.push_back(states[index].out1);
+    } else {
+      closure.push_back(index);
+    }
+  }
+
+  std::sort(closure.begin(), closure.end());
+  return closure;
+}
+
+uint32_t UnitAt(const uint16_t *text, size_t position) {
+  return text[position];
+}
+
+uint32_t UnitAt(const char *text, size_t position) {
+  return static_cast<unsigned char>(text[position]);
+}
+
+// Returns the number of units of the character at a position, which the
+// DFA reads as one.
+size_t GetCharacterWidth(const uint16_t *text, size_t length, size_t position, bool utf8) {
+  uint16_t c = text[position];
+  return c >= 0xD800 && c <= 0xDBFF && position + 1 < length && text[position + 1] >= 0xDC00 && text[position + 1] <= 0xDFFF ? 2 : 1;
+}
+
+size_t GetCharacterWidth(const char *text, size_t length, size_t position, bool utf8) {
+  size_t width = 1;
+  if (utf8) {
+    while (position + width < length && (text[position + width] & 0xC0) == 0x80) {
+      width++;
+    }
+  }
+
+  return width;
+}
+
+// Returns true if a position is inside a character, where no match starts.
+bool IsInsideCharacter(const uint16_t *text, size_t position, bool utf8) {
+  return text[position] >= 0xDC00 && text[position] <= 0xDFFF;
+}
+
+bool IsInsideCharacter(const char *text, size_t position, bool utf8) {
+  return utf8 && (text[position] & 0xC0) == 0x80;
+}
+
+}  // namespace
+
+IgnorePatternSet::IgnorePatternSet() {
+}
+
+bool IgnorePatternSet::Compile(int builtins, const std::vector<std::string>& patterns) {
+  std::vector<std::string> expressions;
+  for (size_t i = 0; i < sizeof(kBuiltinPatterns) / sizeof(kBuiltinPatterns[0]); i++) {
+    if (builtins & kBuiltinPatterns[i].flag) {
+      expressions.push_back(kBuiltinPatterns[i].pattern);
+    }
+  }
+
+  expressions.insert(expressions.end(), patterns.begin(), patterns.end());
+
+  if (expressions.empty()) {
+    transitions.clear();
+    accepting.clear();
+    startClasses.clear();
+    return true;
+  }
+
+  // All the expressions are alternatives of one NFA.
+  std::vector<Node> nodes;
+  std::vector<NFAState> states;
+  int match = AddState(&states, NFAState::MATCH, -1, -1);
+  std::vector<int> starts;
+
+  for (auto expression = expressions.begin(); expression != expressions.end(); ++expression) {
+    size_t root;
+    PatternParser parser(*expression, &nodes);
+    if (!parser.Parse(&root)) {
+      return false;
+    }
+
+    int start = BuildStates(nodes, root, match, &states);
+    if (start < 0) {
+      return false;
+    }
+
+    starts.push_back(start);
+  }
+
+  // Each state of the DFA is the set of NFA states it stands for.
+  std::map<std::vector<int>, int32_t> ids;
+  std::vector<std::vector<int>> sets(1, GetClosure(states, starts));
+  ids[sets[0]] = 0;
+
+  std::vector<int32_t> newTransitions;
+  std::vector<uint8_t> newAccepting;
+
+  for (size_t id = 0; id < sets.size(); id++) {
+    if (sets.size() > kMaxDFAStates) {
+      return false;
+    }
+
+    newAccepting.push_back(0);
+    for (size_t c = 0; c < kClassCount; c++) {
+      std::vector<int> next;
+      for (auto index = sets[id].begin(); index != sets[id].end(); ++index) {
+        const NFAState& state = states[*index];
+        if (state.kind == NFAState::MATCH) {
+          newAccepting[id] = 1;
+        } else if (state.set[c]) {
+          next.push_back(state.out);
+        }
+      }
+
+      if (next.empty()) {
+        newTransitions.push_back(-1);
+        continue;
+      }
+
+      std::vector<int> closure = GetClosure(states, next);
+      auto found = ids.find(closure);
+      if (found == ids.end()) {
+        found = ids.insert(std::make_pair(closure, static_cast<int32_t>(sets.size()))).first;
+        sets.push_back(closure);
+      }
+
+      newTransitions.push_back(found->second);
+    }
+  }
+
+  // A match never takes in whitespace, as it ends every word: long texts
+  // are checked in chunks split at whitespace, and a document session
+  // rechecks the text from the whitespace before an edit to that after it.
+  // Every state can go on to a match, so no state may read whitespace.
+  UnitSet spaces = SpaceSet();
+  for (size_t id = 0; id < sets.size(); id++) {
+    for (size_t c = 0; c < kClassCount; c++) {
+      if (spaces[c] && newTransitions[id * kClassCount + c] >= 0) {
+        return false;
+      }
+    }
+  }
+
+  transitions.swap(newTransitions);
+  accepting.swap(newAccepting);
+  startClasses.assign(kClassCount, 0);
+  for (size_t c = 0; c < kClassCount; c++) {
+    startClasses[c] = transitions[c] >= 0;
+  }
+
+  return true;
+}
+
+bool IgnorePatternSet::IsEmpty() const {
+  return transitions.empty();
+}
+
+bool IgnorePatternSet::NextMatch(const uint16_t *text, size_t length, size_t *position, size_t *start, size_t *end) const {
+  return FindMatch(text, length, false, position, start, end);
+}
+
+bool IgnorePatternSet::NextMatch(const char *text, size_t length, bool utf8, size_t *position, size_t *start, size_t *end) const {
+  return FindMatch(text, length, utf8, position, start, end);
+}
+
+template <typename Unit>
+bool IgnorePatternSet::FindMatch(const Unit *text, size_t length, bool utf8, size_t *position, size_t *start, size_t *end) const {
+  if (transitions.empty()) {
+    *position = length;
+    return false;
+  }
+
+  for (size_t i = *position; i < length; i++) {
+    uint32_t c = UnitAt(text, i);
+    if (!startClasses[c < 0x80 ? c : kNonASCIIClass] || IsInsideCharacter(text, i, utf8)) {
+      continue;
+    }
+
+    if (i > 0) {
+      uint32_t previous = UnitAt(text, i - 1);
+      if (IsASCIILetter(previous) || IsASCIIDigit(previous)) {
+        continue;
+      }
+    }
+
+    // Run the DFA for as long as a match can go on, keeping the end of the
+    // longest one.
+    size_t matchEnd = i;
+    int32_t state = 0;
+    for (size_t j = i; j < length && j - i < kMaxMatchLength;) {
+      uint32_t unit = UnitAt(text, j);
+      state = transitions[state * kClassCount + (unit < 0x80 ? unit : kNonASCIIClass)];
+      if (state < 0) {
+        break;
+      }
+
+      j += GetCharacterWidth(text, length, j, utf8);
+      if (accepting[state]) {
+        matchEnd = j;
+      }
+    }
+
+    if (matchEnd > i) {
+      *start = i;
+      *end = matchEnd;
+      *position = matchEnd;
+      return true;
+    }
+  }
+
+  *position = length;
+  return false;
+}
+
+}  // namespace spellchecker
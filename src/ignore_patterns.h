@@ -0,0 +1,68 @@
+#ifndef SRC_IGNORE_PATTERNS_H_
+#define SRC_IGNORE_PATTERNS_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace spellchecker {
+
+// The built-in recognizers of text that is not made of words.
+const int IGNORE_URLS = 1 << 0;
+const int IGNORE_EMAILS = 1 << 1;
+const int IGNORE_NUMBERS = 1 << 2;
+const int IGNORE_VERSIONS = 1 << 3;
+const int IGNORE_HASHES = 1 << 4;
+
+// Text to skip when checking, such as URLs and email addresses, found by
+// the built-in recognizers and regular expressions compiled together into
+// one DFA, so that the words in it are never looked up.
+//
+// The expressions are a subset of those of JavaScript: characters, escapes
+// such as \d, \w and \s, classes, the any character, groups, alternatives
+// and the *, +, ? and {m,n} quantifiers, with "(?i)" in front to ignore the
+// case of ASCII letters. Any non-ASCII character matches only the any
+// character and negated classes. A match starts where a word or another run
+// of characters does, after a character that is not an ASCII letter or
+// digit, and the longest one is taken. Whitespace ends a match as it ends a
+// word, so expressions that can match it, such as "a b", "a\sb" or "[^x]+",
+// are not supported.
+class IgnorePatternSet {
+public:
+  IgnorePatternSet();
+
+  // Compiles the recognizers given by IGNORE_* flags and the expressions.
+  // Returns false, leaving the set as it was, if an expression is not
+  // supported, can match whitespace, or the DFA grows too large.
+  bool Compile(int builtins, const std::vector<std::string>& patterns);
+
+  bool IsEmpty() const;
+
+  // Finds the next match from *position, which is moved past it. Returns
+  // false if there are no more.
+  bool NextMatch(const uint16_t *text, size_t length, size_t *position, size_t *start, size_t *end) const;
+
+  // The same for Latin-1 or, if utf8 is true, UTF-8 text, with the
+  // positions in bytes.
+  bool NextMatch(const char *text, size_t length, bool utf8, size_t *position, size_t *start, size_t *end) const;
+
+private:
+  template <typename Unit>
+  bool FindMatch(const Unit *text, size_t length, bool utf8, size_t *position, size_t *start, size_t *end) const;
+
+  // The next state for each state and class of unit, or -1 when no match
+  // can go on. State 0 is the start.
+  std::vector<int32_t> transitions;
+
+  // Whether a match can end in each state.
+  std::vector<uint8_t> accepting;
+
+  // Whether a match can start with each class of unit, so the others are
+  // passed over without running the DFA.
+  std::vector<uint8_t> startClasses;
+};
+
+}  // namespace spellchecker
+
+#endif  // SRC_IGNORE_PATTERNS_H_
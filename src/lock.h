@@ -0,0 +1,61 @@
+#ifndef SRC_LOCK_H_
+#define SRC_LOCK_H_
+
+#include <uv.h>
+
+namespace spellchecker {
+
+// Holds a mutex for the lifetime of the scope.
+class Lock {
+public:
+  Lock(uv_mutex_t &m) : m{m}
+  {
+    uv_mutex_lock(&this->m);
+  }
+
+  ~Lock()
+  {
+    uv_mutex_unlock(&this->m);
+  }
+
+private:
+  uv_mutex_t &m;
+};
+
+// Holds a read-write lock for reading for the lifetime of the scope.
+class ReadLock {
+public:
+  ReadLock(uv_rwlock_t &l) : l{l}
+  {
+    uv_rwlock_rdlock(&this->l);
+  }
+
+  ~ReadLock()
+  {
+    uv_rwlock_rdunlock(&this->l);
+  }
+
+private:
+  uv_rwlock_t &l;
+};
+
+// Holds a read-write lock for writing for the lifetime of the scope.
+class WriteLock {
+public:
+  WriteLock(uv_rwlock_t &l) : l{l}
+  {
+    uv_rwlock_wrlock(&this->l);
+  }
+
+  ~WriteLock()
+  {
+    uv_rwlock_wrunlock(&this->l);
+  }
+
+private:
+  uv_rwlock_t &l;
+};
+
+}  // namespace spellchecker
+
+#endif  // SRC_LOCK_H_
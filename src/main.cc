@@ -1,7 +1,9 @@
+#include <cstring>
 #include <vector>
 #include <utility>
 #include "nan.h"
 #include "spellchecker.h"
+#include "document_session.h"
 #include "worker.h"
 
 using Nan::ObjectWrap;
@@ -10,9 +12,47 @@ using namespace v8;
 
 namespace {
 
+// The names of the strategies of finding corrections that can be skipped.
+const struct {
+  const char *name;
+  int flag;
+} kSuggestionStrategies[] = {
+  {"ngram", SKIP_NGRAM_SUGGESTIONS},
+  {"phonetic", SKIP_PHONETIC_SUGGESTIONS},
+  {"twoWords", SKIP_TWO_WORD_SUGGESTIONS},
+  {"compound", SKIP_COMPOUND_SUGGESTIONS},
+};
+
+// The names of the built-in recognizers of text to ignore.
+const struct {
+  const char *name;
+  int flag;
+} kIgnoredTexts[] = {
+  {"url", IGNORE_URLS},
+  {"email", IGNORE_EMAILS},
+  {"number", IGNORE_NUMBERS},
+  {"version", IGNORE_VERSIONS},
+  {"hash", IGNORE_HASHES},
+};
+
+// The names of the formats text can be checked in.
+const struct {
+  const char *name;
+  TextFormat format;
+} kTextFormats[] = {
+  {"text", PLAIN_TEXT_FORMAT},
+  {"html", HTML_FORMAT},
+  {"latex", LATEX_FORMAT},
+  {"markdown", MARKDOWN_FORMAT},
+  {"man", MAN_FORMAT},
+  {"code", SOURCE_CODE_FORMAT},
+};
+
 class Spellchecker : public Nan::ObjectWrap {
   SpellcheckerImplementation* impl;
 
+  static Nan::Persistent<FunctionTemplate> constructorTemplate;
+
   static NAN_METHOD(New) {
     Nan::HandleScope scope;
     Spellchecker* that = new Spellchecker();
@@ -68,7 +108,6 @@ class Spellchecker : public Nan::ObjectWrap {
 
     Spellchecker* that = Nan::ObjectWrap::Unwrap<Spellchecker>(info.Holder());
 
-    std::string language = *Nan::Utf8String(info[0]);
     std::string directory = ".";
     if (info.Length() > 1) {
       directory = *Nan::Utf8String(info[1]);
@@ -77,7 +116,73 @@ class Spellchecker : public Nan::ObjectWrap {
     // Make sure we have the implementation loaded.
     Spellchecker::EnsureLoadedImplementation(that);
 
-    bool result = that->impl->SetDictionary(language, directory);
+    // An array of languages sets all of their dictionaries, tried in order.
+    bool result;
+    std::vector<std::string> languages;
+    if (ReadWords(info[0], &languages)) {
+      result = that->impl->SetDictionaries(languages, directory);
+    } else {
+      std::string language = *Nan::Utf8String(info[0]);
+      result = that->impl->SetDictionary(language, directory);
+    }
+
+    info.GetReturnValue().Set(Nan::New(result));
+  }
+
+  static NAN_METHOD(SetDictionaryAsync) {
+    Nan::HandleScope scope;
+
+    if (info.Length() < 3) {
+      return Nan::ThrowError("Bad arguments");
+    }
+
+    std::vector<std::string> languages;
+    if (!ReadWords(info[0], &languages)) {
+      languages.push_back(*Nan::Utf8String(info[0]));
+    }
+
+    std::string directory = *Nan::Utf8String(info[1]);
+    Nan::Callback *callback = new Nan::Callback(info[2].As<Function>());
+
+    Spellchecker* that = Nan::ObjectWrap::Unwrap<Spellchecker>(info.Holder());
+
+    // Make sure we have the implementation loaded.
+    Spellchecker::EnsureLoadedImplementation(that);
+
+    // The system spellcheckers are set here, as they cannot be used while
+    // they are set on another thread.
+    if (!that->impl->CanSetDictionaryInBackground()) {
+      bool result = that->impl->SetDictionaries(languages, directory);
+
+      Local<Value> argv[] = { Nan::Null(), Nan::New(result) };
+      callback->Call(2, argv);
+      delete callback;
+      return;
+    }
+
+    SetDictionaryWorker* worker = new SetDictionaryWorker(std::move(languages), directory, that->impl, callback);
+
+    // Keep the spellchecker alive while the worker uses it.
+    worker->SaveToPersistent("spellchecker", info.Holder());
+    Nan::AsyncQueueWorker(worker);
+  }
+
+  static NAN_METHOD(CompileDictionary) {
+    Nan::HandleScope scope;
+
+    if (info.Length() < 2) {
+      return Nan::ThrowError("Bad arguments");
+    }
+
+    Spellchecker* that = Nan::ObjectWrap::Unwrap<Spellchecker>(info.Holder());
+
+    std::string language = *Nan::Utf8String(info[0]);
+    std::string directory = *Nan::Utf8String(info[1]);
+
+    // Make sure we have the implementation loaded.
+    Spellchecker::EnsureLoadedImplementation(that);
+
+    bool result = that->impl->CompileDictionary(language, directory);
     info.GetReturnValue().Set(Nan::New(result));
   }
 
@@ -96,49 +201,87 @@ class Spellchecker : public Nan::ObjectWrap {
     info.GetReturnValue().Set(Nan::New(that->impl->IsMisspelled(word)));
   }
 
-  static NAN_METHOD(CheckSpelling) {
+  static NAN_METHOD(IsMisspelledBatch) {
     Nan::HandleScope scope;
     if (info.Length() < 1) {
       return Nan::ThrowError("Bad argument");
     }
 
-    Local<String> string = Local<String>::Cast(info[0]);
-    if (!string->IsString()) {
+    WordBatch batch;
+    if (!ReadWordBatch(info[0], false, &batch)) {
       return Nan::ThrowError("Bad argument");
     }
 
-    Local<Array> result = Nan::New<Array>();
+    Spellchecker* that = Nan::ObjectWrap::Unwrap<Spellchecker>(info.Holder());
+
+    // Make sure we have the implementation loaded.
+    Spellchecker::EnsureLoadedImplementation(that);
+
+    size_t length = batch.words.size();
+    Local<Uint8Array> result = Uint8Array::New(ArrayBuffer::New(Isolate::GetCurrent(), length), 0, length);
+    if (length > 0) {
+      Nan::TypedArrayContents<uint8_t> contents(result);
+      CheckWordBatch(that->impl, batch, *contents);
+    }
+
     info.GetReturnValue().Set(result);
+  }
 
-    if (string->Length() == 0) {
-      return;
+  static NAN_METHOD(IsMisspelledBatchAsync) {
+    Nan::HandleScope scope;
+    if (info.Length() < 2) {
+      return Nan::ThrowError("Bad argument");
     }
 
-    std::vector<uint16_t> text(string->Length() + 1);
-    string->Write(
-#if V8_MAJOR_VERSION > 6
-        info.GetIsolate(),
-#endif
-        reinterpret_cast<uint16_t *>(text.data()));
+    WordBatch batch;
+    if (!ReadWordBatch(info[0], true, &batch)) {
+      return Nan::ThrowError("Bad argument");
+    }
+
+    Nan::Callback *callback = new Nan::Callback(info[1].As<Function>());
 
     Spellchecker* that = Nan::ObjectWrap::Unwrap<Spellchecker>(info.Holder());
 
     // Make sure we have the implementation loaded.
     Spellchecker::EnsureLoadedImplementation(that);
 
-    std::vector<MisspelledRange> misspelled_ranges = that->impl->CheckSpelling(text.data(), text.size());
+    IsMisspelledBatchWorker* worker = new IsMisspelledBatchWorker(std::move(batch), that->impl, callback);
 
-    std::vector<MisspelledRange>::const_iterator iter = misspelled_ranges.begin();
-    v8::Local<v8::Context> context = Nan::GetCurrentContext();
-    for (; iter != misspelled_ranges.end(); ++iter) {
-      size_t index = iter - misspelled_ranges.begin();
-      uint32_t start = iter->start, end = iter->end;
+    // Keep the spellchecker alive while the worker uses it.
+    worker->SaveToPersistent("spellchecker", info.Holder());
+    Nan::AsyncQueueWorker(worker);
+  }
 
-      Local<Object> misspelled_range = Nan::New<Object>();
-      misspelled_range->Set(context, Nan::New("start").ToLocalChecked(), Nan::New<Integer>(start));
-      misspelled_range->Set(context, Nan::New("end").ToLocalChecked(), Nan::New<Integer>(end));
-      result->Set(context, index, misspelled_range);
+  static NAN_METHOD(CheckSpelling) {
+    Nan::HandleScope scope;
+    if (info.Length() < 1) {
+      return Nan::ThrowError("Bad argument");
+    }
+
+    Corpus corpus;
+    if (!ReadCorpus(info[0], false, &corpus)) {
+      return Nan::ThrowError("Bad argument");
     }
+
+    Local<Value> packed;
+    if (!ReadCheckOptions(info[1], &corpus.format, &packed)) {
+      return Nan::ThrowError("Bad argument");
+    }
+
+    std::vector<MisspelledRange> misspelled_ranges;
+
+    if (corpus.length > 0) {
+      Spellchecker* that = Nan::ObjectWrap::Unwrap<Spellchecker>(info.Holder());
+
+      // Make sure we have the implementation loaded.
+      Spellchecker::EnsureLoadedImplementation(that);
+
+      misspelled_ranges = corpus.utf16 ?
+        that->impl->CheckSpelling(corpus.utf16, corpus.length, corpus.format) :
+        that->impl->CheckSpelling(corpus.bytes, corpus.length, corpus.encoding, corpus.format);
+    }
+
+    info.GetReturnValue().Set(MisspelledRangesToJS(misspelled_ranges, packed));
   }
 
   static NAN_METHOD(CheckSpellingAsync) {
@@ -147,19 +290,17 @@ class Spellchecker : public Nan::ObjectWrap {
       return Nan::ThrowError("Bad argument");
     }
 
-    Local<String> string = Local<String>::Cast(info[0]);
-    if (!string->IsString()) {
+    Corpus corpus;
+    if (!ReadCorpus(info[0], true, &corpus)) {
       return Nan::ThrowError("Bad argument");
     }
 
-    Nan::Callback *callback = new Nan::Callback(info[1].As<Function>());
+    Local<Value> packed;
+    if (!ReadCheckOptions(info[2], &corpus.format, &packed)) {
+      return Nan::ThrowError("Bad argument");
+    }
 
-    std::vector<uint16_t> corpus(string->Length() + 1);
-    string->Write(
-#if V8_MAJOR_VERSION > 6
-        info.GetIsolate(),
-#endif
-        reinterpret_cast<uint16_t *>(corpus.data()));
+    Nan::Callback *callback = new Nan::Callback(info[1].As<Function>());
 
     Spellchecker* that = Nan::ObjectWrap::Unwrap<Spellchecker>(info.Holder());
 
@@ -167,9 +308,38 @@ class Spellchecker : public Nan::ObjectWrap {
     Spellchecker::EnsureLoadedImplementation(that);
 
     CheckSpellingWorker* worker = new CheckSpellingWorker(std::move(corpus), that->impl, callback);
+
+    // Keep the spellchecker alive while the worker uses it, and the text too
+    // when it is an external string read in place. The array the ranges may
+    // be packed into is only written once the worker is done.
+    worker->SaveToPersistent("spellchecker", info.Holder());
+    worker->SaveToPersistent("corpus", info[0]);
+    worker->SaveToPersistent("packed", packed);
     Nan::AsyncQueueWorker(worker);
   }
 
+  static NAN_METHOD(GetCacheStats) {
+    Nan::HandleScope scope;
+
+    Spellchecker* that = Nan::ObjectWrap::Unwrap<Spellchecker>(info.Holder());
+
+    // Make sure we have the implementation loaded.
+    Spellchecker::EnsureLoadedImplementation(that);
+
+    Local<Object> result = Nan::New<Object>();
+    Nan::Set(result, Nan::New("verdicts").ToLocalChecked(), CacheStatsToJS(that->impl->GetVerdictCacheStats()));
+    Nan::Set(result, Nan::New("suggestions").ToLocalChecked(), CacheStatsToJS(that->impl->GetSuggestionCacheStats()));
+    info.GetReturnValue().Set(result);
+  }
+
+  static Local<Object> CacheStatsToJS(const CacheStats& stats) {
+    Local<Object> result = Nan::New<Object>();
+    Nan::Set(result, Nan::New("hits").ToLocalChecked(), Nan::New<Number>(static_cast<double>(stats.hits)));
+    Nan::Set(result, Nan::New("misses").ToLocalChecked(), Nan::New<Number>(static_cast<double>(stats.misses)));
+    Nan::Set(result, Nan::New("size").ToLocalChecked(), Nan::New<Number>(static_cast<double>(stats.size)));
+    return result;
+  }
+
   static NAN_METHOD(Add) {
     Nan::HandleScope scope;
     if (info.Length() < 1) {
@@ -202,6 +372,72 @@ class Spellchecker : public Nan::ObjectWrap {
     return;
   }
 
+  static NAN_METHOD(AddWords) {
+    Nan::HandleScope scope;
+
+    std::vector<std::string> words;
+    if (info.Length() < 1 || !ReadWords(info[0], &words)) {
+      return Nan::ThrowError("Bad argument");
+    }
+
+    Spellchecker* that = Nan::ObjectWrap::Unwrap<Spellchecker>(info.Holder());
+
+    // Make sure we have the implementation loaded.
+    Spellchecker::EnsureLoadedImplementation(that);
+
+    that->impl->AddWords(words);
+  }
+
+  static NAN_METHOD(RemoveWords) {
+    Nan::HandleScope scope;
+
+    std::vector<std::string> words;
+    if (info.Length() < 1 || !ReadWords(info[0], &words)) {
+      return Nan::ThrowError("Bad argument");
+    }
+
+    Spellchecker* that = Nan::ObjectWrap::Unwrap<Spellchecker>(info.Holder());
+
+    // Make sure we have the implementation loaded.
+    Spellchecker::EnsureLoadedImplementation(that);
+
+    that->impl->RemoveWords(words);
+  }
+
+  static NAN_METHOD(SetPersonalDictionary) {
+    Nan::HandleScope scope;
+    if (info.Length() < 1) {
+      return Nan::ThrowError("Bad argument");
+    }
+
+    Spellchecker* that = Nan::ObjectWrap::Unwrap<Spellchecker>(info.Holder());
+
+    std::string path = *Nan::Utf8String(info[0]);
+
+    // Make sure we have the implementation loaded.
+    Spellchecker::EnsureLoadedImplementation(that);
+
+    bool result = that->impl->SetPersonalDictionary(path);
+    info.GetReturnValue().Set(Nan::New(result));
+  }
+
+  static NAN_METHOD(SetIgnorePatterns) {
+    Nan::HandleScope scope;
+
+    IgnorePatternSet patterns;
+    if (!ReadIgnorePatterns(info[0], &patterns)) {
+      return Nan::ThrowError("Bad argument");
+    }
+
+    Spellchecker* that = Nan::ObjectWrap::Unwrap<Spellchecker>(info.Holder());
+
+    // Make sure we have the implementation loaded.
+    Spellchecker::EnsureLoadedImplementation(that);
+
+    bool result = that->impl->SetIgnorePatterns(patterns);
+    info.GetReturnValue().Set(Nan::New(result));
+  }
+
   static NAN_METHOD(GetAvailableDictionaries) {
     Nan::HandleScope scope;
 
@@ -239,20 +475,43 @@ class Spellchecker : public Nan::ObjectWrap {
     // Make sure we have the implementation loaded.
     Spellchecker::EnsureLoadedImplementation(that);
 
+    SuggestionOptions options;
+    if (!ReadSuggestionOptions(info[1], &options)) {
+      return Nan::ThrowError("Bad argument");
+    }
+
     std::string word = *Nan::Utf8String(info[0]);
     std::vector<std::string> corrections =
-      that->impl->GetCorrectionsForMisspelling(word);
+      that->impl->GetCorrectionsForMisspelling(word, options);
 
-    Local<Array> result = Nan::New<Array>(corrections.size());
-    v8::Local<v8::Context> context = Nan::GetCurrentContext();
-    for (size_t i = 0; i < corrections.size(); ++i) {
-      const std::string& word = corrections[i];
+    info.GetReturnValue().Set(CorrectionsToJS(corrections));
+  }
+
+  static NAN_METHOD(GetCorrectionsForMisspellingAsync) {
+    Nan::HandleScope scope;
+    // Read the words here, as the array may change before the worker runs.
+    std::vector<std::string> words;
+    if (info.Length() < 2 || !ReadWords(info[0], &words)) {
+      return Nan::ThrowError("Bad argument");
+    }
 
-      Nan::MaybeLocal<String> val = Nan::New<String>(word.data(), word.size());
-      result->Set(context, i, val.ToLocalChecked());
+    SuggestionOptions options;
+    if (!ReadSuggestionOptions(info[2], &options)) {
+      return Nan::ThrowError("Bad argument");
     }
 
-    info.GetReturnValue().Set(result);
+    Nan::Callback *callback = new Nan::Callback(info[1].As<Function>());
+
+    Spellchecker* that = Nan::ObjectWrap::Unwrap<Spellchecker>(info.Holder());
+
+    // Make sure we have the implementation loaded.
+    Spellchecker::EnsureLoadedImplementation(that);
+
+    GetCorrectionsWorker* worker = new GetCorrectionsWorker(std::move(words), options, that->impl, callback);
+
+    // Keep the spellchecker alive while the worker uses it.
+    worker->SaveToPersistent("spellchecker", info.Holder());
+    Nan::AsyncQueueWorker(worker);
   }
 
   Spellchecker() {
@@ -264,6 +523,304 @@ class Spellchecker : public Nan::ObjectWrap {
     delete impl;
   }
 
+  // Reads the text to check from a string, a Uint16Array of UTF-16 or a
+  // Uint8Array of UTF-8. Typed arrays are read in place unless copy is set,
+  // as it must be for text read off the main thread: their buffer can be
+  // detached or transferred meanwhile, which keeping the array alive does not
+  // prevent. External one-byte strings are read in place, and other one-byte
+  // strings are copied without being widened to UTF-16. Returns false if the
+  // value is none of these.
+  static bool ReadCorpus(Local<Value> value, bool copy, Corpus *corpus) {
+    if (value->IsUint16Array()) {
+      Nan::TypedArrayContents<uint16_t> contents(value);
+      corpus->utf16 = *contents;
+      corpus->length = contents.length();
+      if (copy) {
+        corpus->utf16Copy.assign(corpus->utf16, corpus->utf16 + corpus->length);
+        corpus->utf16 = corpus->utf16Copy.data();
+      }
+      return true;
+    }
+
+    if (value->IsUint8Array()) {
+      Nan::TypedArrayContents<char> contents(value);
+      corpus->bytes = *contents;
+      corpus->encoding = UTF8_TEXT;
+      corpus->length = contents.length();
+      if (copy) {
+        corpus->bytesCopy.assign(corpus->bytes, corpus->bytes + corpus->length);
+        corpus->bytes = corpus->bytesCopy.data();
+      }
+      return true;
+    }
+
+    if (!value->IsString()) {
+      return false;
+    }
+
+    Local<String> string = value.As<String>();
+    corpus->length = string->Length();
+
+    const String::ExternalOneByteStringResource *resource = string->GetExternalOneByteStringResource();
+    if (resource) {
+      corpus->bytes = resource->data();
+      corpus->encoding = LATIN1_TEXT;
+    } else if (string->IsOneByte()) {
+      corpus->bytesCopy.resize(corpus->length + 1);
+      string->WriteOneByte(
+#if V8_MAJOR_VERSION > 6
+          Isolate::GetCurrent(),
+#endif
+          reinterpret_cast<uint8_t *>(corpus->bytesCopy.data()));
+      corpus->bytes = corpus->bytesCopy.data();
+      corpus->encoding = LATIN1_TEXT;
+    } else {
+      corpus->utf16Copy.resize(corpus->length + 1);
+      string->Write(
+#if V8_MAJOR_VERSION > 6
+          Isolate::GetCurrent(),
+#endif
+          reinterpret_cast<uint16_t *>(corpus->utf16Copy.data()));
+      corpus->utf16 = corpus->utf16Copy.data();
+    }
+
+    return true;
+  }
+
+  // Reads the options of a check, either the packed value described by
+  // MisspelledRangesToJS or an object with any of format, the name of the
+  // markup of the text, and packed. Returns false if the value is an object
+  // with an unknown format.
+  static bool ReadCheckOptions(Local<Value> value, TextFormat *format, Local<Value> *packed) {
+    *format = PLAIN_TEXT_FORMAT;
+    *packed = value;
+
+    if (!value->IsObject() || value->IsUint32Array()) {
+      return true;
+    }
+
+    Local<Object> object = value.As<Object>();
+    *packed = Nan::Get(object, Nan::New("packed").ToLocalChecked()).ToLocalChecked();
+
+    Local<Value> name = Nan::Get(object, Nan::New("format").ToLocalChecked()).ToLocalChecked();
+    if (name->IsUndefined()) {
+      return true;
+    }
+
+    std::string formatName = *Nan::Utf8String(name);
+    for (size_t i = 0; i < sizeof(kTextFormats) / sizeof(kTextFormats[0]); ++i) {
+      if (formatName == kTextFormats[i].name) {
+        *format = kTextFormats[i].format;
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  // Reads and compiles the text to ignore from an object with any of
+  // builtin, an array of the names of recognizers, and patterns, an array of
+  // RegExps or their sources. Returns false if the value is neither
+  // undefined nor such an object, or a pattern is not supported.
+  static bool ReadIgnorePatterns(Local<Value> value, IgnorePatternSet *patterns) {
+    int builtins = 0;
+    std::vector<std::string> expressions;
+
+    if (!value->IsUndefined()) {
+      if (!value->IsObject()) {
+        return false;
+      }
+
+      Local<Object> object = value.As<Object>();
+
+      Local<Value> builtin = Nan::Get(object, Nan::New("builtin").ToLocalChecked()).ToLocalChecked();
+      if (!builtin->IsUndefined()) {
+        if (!builtin->IsArray()) {
+          return false;
+        }
+
+        Local<Array> names = builtin.As<Array>();
+        for (uint32_t i = 0; i < names->Length(); ++i) {
+          std::string name = *Nan::Utf8String(Nan::Get(names, i).ToLocalChecked());
+
+          int flag = 0;
+          for (size_t j = 0; j < sizeof(kIgnoredTexts) / sizeof(kIgnoredTexts[0]); ++j) {
+            if (name == kIgnoredTexts[j].name) {
+              flag = kIgnoredTexts[j].flag;
+            }
+          }
+
+          if (!flag) {
+            return false;
+          }
+
+          builtins |= flag;
+        }
+      }
+
+      Local<Value> list = Nan::Get(object, Nan::New("patterns").ToLocalChecked()).ToLocalChecked();
+      if (!list->IsUndefined()) {
+        if (!list->IsArray()) {
+          return false;
+        }
+
+        Local<Array> array = list.As<Array>();
+        for (uint32_t i = 0; i < array->Length(); ++i) {
+          Local<Value> pattern = Nan::Get(array, i).ToLocalChecked();
+
+          if (pattern->IsRegExp()) {
+            Local<RegExp> regExp = pattern.As<RegExp>();
+            std::string source = *Nan::Utf8String(regExp->GetSource());
+            expressions.push_back((regExp->GetFlags() & RegExp::kIgnoreCase) ? "(?i)" + source : source);
+          } else {
+            expressions.push_back(*Nan::Utf8String(pattern));
+          }
+        }
+      }
+    }
+
+    return patterns->Compile(builtins, expressions);
+  }
+
+  // Reads the limits of a search for corrections from an object with any of
+  // timeout, maxSuggestions and skip, an array of the names of strategies.
+  // Returns false if the value is neither undefined nor such an object.
+  static bool ReadSuggestionOptions(Local<Value> value, SuggestionOptions *options) {
+    if (value->IsUndefined()) {
+      return true;
+    }
+
+    if (!value->IsObject()) {
+      return false;
+    }
+
+    Local<Object> object = value.As<Object>();
+
+    Local<Value> timeout = Nan::Get(object, Nan::New("timeout").ToLocalChecked()).ToLocalChecked();
+    if (!timeout->IsUndefined()) {
+      if (!timeout->IsNumber() || !(timeout.As<Number>()->Value() >= 0)) {
+        return false;
+      }
+
+      options->timeout = timeout.As<Number>()->Value();
+    }
+
+    Local<Value> maxSuggestions = Nan::Get(object, Nan::New("maxSuggestions").ToLocalChecked()).ToLocalChecked();
+    if (!maxSuggestions->IsUndefined()) {
+      if (!maxSuggestions->IsUint32()) {
+        return false;
+      }
+
+      options->maxSuggestions = maxSuggestions.As<Uint32>()->Value();
+    }
+
+    Local<Value> skip = Nan::Get(object, Nan::New("skip").ToLocalChecked()).ToLocalChecked();
+    if (!skip->IsUndefined()) {
+      if (!skip->IsArray()) {
+        return false;
+      }
+
+      Local<Array> names = skip.As<Array>();
+      for (uint32_t i = 0; i < names->Length(); ++i) {
+        std::string name = *Nan::Utf8String(Nan::Get(names, i).ToLocalChecked());
+
+        int flag = 0;
+        for (size_t j = 0; j < sizeof(kSuggestionStrategies) / sizeof(kSuggestionStrategies[0]); ++j) {
+          if (name == kSuggestionStrategies[j].name) {
+            flag = kSuggestionStrategies[j].flag;
+          }
+        }
+
+        if (!flag) {
+          return false;
+        }
+
+        options->skip |= flag;
+      }
+    }
+
+    return true;
+  }
+
+  // Reads an Array of words, each converted to a string.
+  static bool ReadWords(Local<Value> value, std::vector<std::string> *words) {
+    if (!value->IsArray()) {
+      return false;
+    }
+
+    Local<Array> array = value.As<Array>();
+    words->reserve(array->Length());
+    for (uint32_t i = 0; i < array->Length(); ++i) {
+      words->push_back(*Nan::Utf8String(Nan::Get(array, i).ToLocalChecked()));
+    }
+
+    return true;
+  }
+
+  // Reads the words of a batch from an Array of strings, or a Uint8Array of
+  // UTF-8 words, each on its own line, which is read in place unless copy is
+  // set, as it must be for words checked off the main thread (see
+  // ReadCorpus). Returns false if the value is neither of these.
+  static bool ReadWordBatch(Local<Value> value, bool copy, WordBatch *batch) {
+    if (value->IsUint8Array()) {
+      Nan::TypedArrayContents<char> contents(value);
+      const char *bytes = *contents;
+      size_t length = contents.length();
+      if (copy) {
+        batch->bytesCopy.assign(bytes, bytes + length);
+        bytes = batch->bytesCopy.data();
+      }
+
+      batch->bytes = bytes;
+      for (size_t start = 0; start < length;) {
+        const char *newline = static_cast<const char *>(memchr(bytes + start, '\n', length - start));
+        size_t end = newline ? newline - bytes : length;
+
+        WordRange word = {start, end};
+        batch->words.push_back(word);
+        start = end + 1;
+      }
+
+      return true;
+    }
+
+    if (!value->IsArray()) {
+      return false;
+    }
+
+    Isolate *isolate = Isolate::GetCurrent();
+    Local<Array> array = value.As<Array>();
+    batch->words.resize(array->Length());
+
+    for (uint32_t i = 0; i < array->Length(); ++i) {
+      Local<Value> element = Nan::Get(array, i).ToLocalChecked();
+      if (!element->IsString()) {
+        return false;
+      }
+
+      // Write the words one after the other, without a copy of each.
+      Local<String> string = element.As<String>();
+      size_t start = batch->bytesCopy.size();
+#if V8_MAJOR_VERSION > 6
+      size_t length = string->Utf8Length(isolate);
+#else
+      size_t length = string->Utf8Length();
+#endif
+      batch->bytesCopy.resize(start + length + 1);
+      string->WriteUtf8(
+#if V8_MAJOR_VERSION > 6
+          isolate,
+#endif
+          batch->bytesCopy.data() + start, static_cast<int>(length + 1));
+
+      WordRange word = {start, start + length};
+      batch->words[i] = word;
+    }
+
+    batch->bytes = batch->bytesCopy.data();
+    return true;
+  }
+
   static void EnsureLoadedImplementation(Spellchecker *that) {
     if (!that->impl) {
       that->impl = SpellcheckerFactory::CreateSpellchecker(USE_SYSTEM_DEFAULTS);
@@ -271,21 +828,44 @@ class Spellchecker : public Nan::ObjectWrap {
   }
 
  public:
+  // Returns the implementation of a Spellchecker, loading it if needed, or
+  // NULL if the value is not a Spellchecker.
+  static SpellcheckerImplementation* GetImplementation(Local<Value> value) {
+    if (!Nan::New(constructorTemplate)->HasInstance(value)) {
+      return NULL;
+    }
+
+    Spellchecker* that = Nan::ObjectWrap::Unwrap<Spellchecker>(value.As<Object>());
+    Spellchecker::EnsureLoadedImplementation(that);
+    return that->impl;
+  }
+
   static void Init(Local<Object> exports) {
     Local<FunctionTemplate> tpl = Nan::New<FunctionTemplate>(Spellchecker::New);
+    constructorTemplate.Reset(tpl);
 
     tpl->SetClassName(Nan::New<String>("Spellchecker").ToLocalChecked());
     tpl->InstanceTemplate()->SetInternalFieldCount(1);
 
     Nan::SetPrototypeMethod(tpl, "setSpellcheckerType", Spellchecker::SetSpellcheckerType);
     Nan::SetPrototypeMethod(tpl, "setDictionary", Spellchecker::SetDictionary);
+    Nan::SetPrototypeMethod(tpl, "setDictionaryAsync", Spellchecker::SetDictionaryAsync);
+    Nan::SetPrototypeMethod(tpl, "compileDictionary", Spellchecker::CompileDictionary);
     Nan::SetPrototypeMethod(tpl, "getAvailableDictionaries", Spellchecker::GetAvailableDictionaries);
     Nan::SetPrototypeMethod(tpl, "getCorrectionsForMisspelling", Spellchecker::GetCorrectionsForMisspelling);
+    Nan::SetPrototypeMethod(tpl, "getCorrectionsForMisspellingAsync", Spellchecker::GetCorrectionsForMisspellingAsync);
     Nan::SetPrototypeMethod(tpl, "isMisspelled", Spellchecker::IsMisspelled);
+    Nan::SetPrototypeMethod(tpl, "isMisspelledBatch", Spellchecker::IsMisspelledBatch);
+    Nan::SetPrototypeMethod(tpl, "isMisspelledBatchAsync", Spellchecker::IsMisspelledBatchAsync);
     Nan::SetPrototypeMethod(tpl, "checkSpelling", Spellchecker::CheckSpelling);
     Nan::SetPrototypeMethod(tpl, "checkSpellingAsync", Spellchecker::CheckSpellingAsync);
+    Nan::SetPrototypeMethod(tpl, "getCacheStats", Spellchecker::GetCacheStats);
     Nan::SetPrototypeMethod(tpl, "add", Spellchecker::Add);
     Nan::SetPrototypeMethod(tpl, "remove", Spellchecker::Remove);
+    Nan::SetPrototypeMethod(tpl, "addWords", Spellchecker::AddWords);
+    Nan::SetPrototypeMethod(tpl, "removeWords", Spellchecker::RemoveWords);
+    Nan::SetPrototypeMethod(tpl, "setPersonalDictionary", Spellchecker::SetPersonalDictionary);
+    Nan::SetPrototypeMethod(tpl, "setIgnorePatterns", Spellchecker::SetIgnorePatterns);
 
     Isolate* isolate = exports->GetIsolate();
     Local<Context> context = isolate->GetCurrentContext();
@@ -293,8 +873,122 @@ class Spellchecker : public Nan::ObjectWrap {
   }
 };
 
+Nan::Persistent<FunctionTemplate> Spellchecker::constructorTemplate;
+
+// A document being edited, which rechecks only the words around each edit.
+// It keeps the Spellchecker it was created with alive.
+class DocumentSessionObject : public Nan::ObjectWrap {
+  std::unique_ptr<DocumentSession> session;
+  Nan::Persistent<Object> spellchecker;
+
+  static NAN_METHOD(New) {
+    Nan::HandleScope scope;
+    if (info.Length() < 2 || !info[1]->IsString()) {
+      return Nan::ThrowError("Bad argument");
+    }
+
+    SpellcheckerImplementation* impl = Spellchecker::GetImplementation(info[0]);
+    if (!impl) {
+      return Nan::ThrowError("Bad argument: expected a Spellchecker");
+    }
+
+    DocumentSessionObject* that = new DocumentSessionObject(impl);
+    that->spellchecker.Reset(info[0].As<Object>());
+    that->Wrap(info.This());
+
+    std::vector<uint16_t> text = ReadString(info[1]);
+    that->session->SetText(text.data(), text.size());
+
+    info.GetReturnValue().Set(info.This());
+  }
+
+  static NAN_METHOD(SetText) {
+    Nan::HandleScope scope;
+    if (info.Length() < 1 || !info[0]->IsString()) {
+      return Nan::ThrowError("Bad argument");
+    }
+
+    DocumentSessionObject* that = Nan::ObjectWrap::Unwrap<DocumentSessionObject>(info.Holder());
+
+    std::vector<uint16_t> text = ReadString(info[0]);
+    that->session->SetText(text.data(), text.size());
+
+    info.GetReturnValue().Set(MisspelledRangesToJS(that->session->GetMisspelledRanges(), info[1]));
+  }
+
+  static NAN_METHOD(Edit) {
+    Nan::HandleScope scope;
+    if (info.Length() < 3 || !info[0]->IsUint32() || !info[1]->IsUint32() || !info[2]->IsString()) {
+      return Nan::ThrowError("Bad argument");
+    }
+
+    DocumentSessionObject* that = Nan::ObjectWrap::Unwrap<DocumentSessionObject>(info.Holder());
+
+    v8::Local<v8::Context> context = Nan::GetCurrentContext();
+    uint32_t offset = info[0]->Uint32Value(context).ToChecked();
+    uint32_t removed_length = info[1]->Uint32Value(context).ToChecked();
+    std::vector<uint16_t> inserted = ReadString(info[2]);
+
+    MisspelledRange checked;
+    std::vector<MisspelledRange> misspelled;
+    if (!that->session->Edit(offset, removed_length, inserted.data(), inserted.size(), &checked, &misspelled)) {
+      return Nan::ThrowError("Bad argument: the edit is past the end of the text");
+    }
+
+    Local<Object> result = Nan::New<Object>();
+    result->Set(context, Nan::New("start").ToLocalChecked(), Nan::New<Integer>(static_cast<uint32_t>(checked.start)));
+    result->Set(context, Nan::New("end").ToLocalChecked(), Nan::New<Integer>(static_cast<uint32_t>(checked.end)));
+    result->Set(context, Nan::New("misspelled").ToLocalChecked(), MisspelledRangesToJS(misspelled, info[3]));
+    info.GetReturnValue().Set(result);
+  }
+
+  static NAN_METHOD(GetMisspelledRanges) {
+    Nan::HandleScope scope;
+
+    DocumentSessionObject* that = Nan::ObjectWrap::Unwrap<DocumentSessionObject>(info.Holder());
+    info.GetReturnValue().Set(MisspelledRangesToJS(that->session->GetMisspelledRanges(), info[0]));
+  }
+
+  static std::vector<uint16_t> ReadString(Local<Value> value) {
+    Local<String> string = value.As<String>();
+    std::vector<uint16_t> result(string->Length() + 1);
+    string->Write(
+#if V8_MAJOR_VERSION > 6
+        Isolate::GetCurrent(),
+#endif
+        reinterpret_cast<uint16_t *>(result.data()));
+
+    result.pop_back();
+    return result;
+  }
+
+  DocumentSessionObject(SpellcheckerImplementation* impl) : session(new DocumentSession(impl)) {
+  }
+
+  virtual ~DocumentSessionObject() {
+    spellchecker.Reset();
+  }
+
+ public:
+  static void Init(Local<Object> exports) {
+    Local<FunctionTemplate> tpl = Nan::New<FunctionTemplate>(DocumentSessionObject::New);
+
+    tpl->SetClassName(Nan::New<String>("DocumentSession").ToLocalChecked());
+    tpl->InstanceTemplate()->SetInternalFieldCount(1);
+
+    Nan::SetPrototypeMethod(tpl, "setText", DocumentSessionObject::SetText);
+    Nan::SetPrototypeMethod(tpl, "edit", DocumentSessionObject::Edit);
+    Nan::SetPrototypeMethod(tpl, "getMisspelledRanges", DocumentSessionObject::GetMisspelledRanges);
+
+    Isolate* isolate = exports->GetIsolate();
+    Local<Context> context = isolate->GetCurrentContext();
+    Nan::Set(exports, Nan::New("DocumentSession").ToLocalChecked(), tpl->GetFunction(context).ToLocalChecked());
+  }
+};
+
 void Init(Local<Object> exports, Local<Object> module) {
   Spellchecker::Init(exports);
+  DocumentSessionObject::Init(exports);
 }
 
 }  // namespace
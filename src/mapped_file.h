@@ -0,0 +1,30 @@
+#ifndef SRC_MAPPED_FILE_H_
+#define SRC_MAPPED_FILE_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string>
+
+namespace spellchecker {
+
+struct MappedFile;
+
+// Maps a whole file read-only into memory. The pages are shared with the
+// other processes mapping the same file.
+MappedFile *NewMappedFile(const std::string& path);
+
+void FreeMappedFile(MappedFile *);
+
+const char *GetMappedData(const MappedFile *);
+size_t GetMappedSize(const MappedFile *);
+
+// Gets the size and the modification time of a file.
+bool GetFileStamp(const std::string& path, uint64_t *size, uint64_t *mtime);
+
+// Replaces the contents of a file without exposing a partially written one
+// to concurrent readers.
+bool WriteFileAtomically(const std::string& path, const char *data, size_t length);
+
+}  // namespace spellchecker
+
+#endif  // SRC_MAPPED_FILE_H_
@@ -0,0 +1,86 @@
+#include <cstdio>
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "mapped_file.h"
+
+namespace spellchecker {
+
+struct MappedFile {
+  void *data;
+  size_t size;
+};
+
+MappedFile *NewMappedFile(const std::string& path) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return NULL;
+  }
+
+  struct stat info;
+  if (fstat(fd, &info) != 0 || info.st_size == 0) {
+    close(fd);
+    return NULL;
+  }
+
+  // The mapping stays valid after the descriptor is closed.
+  void *data = mmap(NULL, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return NULL;
+  }
+
+  MappedFile *result = new MappedFile();
+  result->data = data;
+  result->size = info.st_size;
+  return result;
+}
+
+void FreeMappedFile(MappedFile *file) {
+  munmap(file->data, file->size);
+  delete file;
+}
+
+const char *GetMappedData(const MappedFile *file) {
+  return static_cast<const char *>(file->data);
+}
+
+size_t GetMappedSize(const MappedFile *file) {
+  return file->size;
+}
+
+bool GetFileStamp(const std::string& path, uint64_t *size, uint64_t *mtime) {
+  struct stat info;
+  if (stat(path.c_str(), &info) != 0) {
+    return false;
+  }
+
+  *size = info.st_size;
+  *mtime = info.st_mtime;
+  return true;
+}
+
+bool WriteFileAtomically(const std::string& path, const char *data, size_t length) {
+  // Write a private temporary file next to the target, then rename it over
+  // the target so readers either see the old file or the complete new one.
+  std::string temp = path + "." + std::to_string(getpid()) + ".tmp";
+
+  FILE *handle = fopen(temp.c_str(), "wb");
+  if (!handle) {
+    return false;
+  }
+
+  bool written = fwrite(data, 1, length, handle) == length;
+  written = fclose(handle) == 0 && written;
+
+  if (!written || rename(temp.c_str(), path.c_str()) != 0) {
+    remove(temp.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+}  // namespace spellchecker
@@ -0,0 +1,95 @@
+#include <windows.h>
+#include <sys/stat.h>
+#include <stdint.h>
+#include <cstdio>
+#include "mapped_file.h"
+
+namespace spellchecker {
+
+struct MappedFile {
+  HANDLE mapping;
+  const void *data;
+  size_t size;
+};
+
+MappedFile *NewMappedFile(const std::string& path) {
+  // TODO: This code is almost certainly jacked on Win32 for non-ASCII paths
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+    NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE) {
+    return NULL;
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+    CloseHandle(file);
+    return NULL;
+  }
+
+  // The mapping keeps the file open after its handle is closed.
+  HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  CloseHandle(file);
+  if (mapping == NULL) {
+    return NULL;
+  }
+
+  const void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (data == NULL) {
+    CloseHandle(mapping);
+    return NULL;
+  }
+
+  MappedFile *result = new MappedFile();
+  result->mapping = mapping;
+  result->data = data;
+  result->size = static_cast<size_t>(size.QuadPart);
+  return result;
+}
+
+void FreeMappedFile(MappedFile *file) {
+  UnmapViewOfFile(file->data);
+  CloseHandle(file->mapping);
+  delete file;
+}
+
+const char *GetMappedData(const MappedFile *file) {
+  return static_cast<const char *>(file->data);
+}
+
+size_t GetMappedSize(const MappedFile *file) {
+  return file->size;
+}
+
+bool GetFileStamp(const std::string& path, uint64_t *size, uint64_t *mtime) {
+  struct _stat64 info;
+  if (_stat64(path.c_str(), &info) != 0) {
+    return false;
+  }
+
+  *size = info.st_size;
+  *mtime = info.st_mtime;
+  return true;
+}
+
+bool WriteFileAtomically(const std::string& path, const char *data, size_t length) {
+  // Write a private temporary file next to the target, then move it over
+  // the target so readers either see the old file or the complete new one.
+  std::string temp = path + "." + std::to_string(GetCurrentProcessId()) + ".tmp";
+
+  FILE *handle = fopen(temp.c_str(), "wb");
+  if (!handle) {
+    return false;
+  }
+
+  bool written = fwrite(data, 1, length, handle) == length;
+  written = fclose(handle) == 0 && written;
+
+  if (!written || !MoveFileExA(temp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING)) {
+    remove(temp.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+}  // namespace spellchecker
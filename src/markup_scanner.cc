@@ -0,0 +1,1095 @@
+#include <cstring>
+#include <string>
+#include "markup_scanner.h"
+
+namespace spellchecker {
+
+namespace {
+
+uint32_t UnitAt(const uint16_t *text, size_t position) {
+  return text[position];
+}
+
+uint32_t UnitAt(const char *text, size_t position) {
+  return static_cast<unsigned char>(text[position]);
+}
+
+bool IsASCIILetter(uint32_t c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+bool IsASCIIDigit(uint32_t c) {
+  return c >= '0' && c <= '9';
+}
+
+bool IsBlank(uint32_t c) {
+  return c == ' ' || c == '\t';
+}
+
+uint32_t ToASCIILower(uint32_t c) {
+  return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+}
+
+// Returns true if markup from start to end has letters right before and
+// after it, so that markup of no width there is inside a word.
+template <typename Unit>
+bool IsBetweenLetters(const Unit *text, size_t length, size_t start, size_t end) {
+  if (start == 0 || end >= length) {
+    return false;
+  }
+
+  uint32_t before = UnitAt(text, start - 1), after = UnitAt(text, end);
+  return (IsASCIILetter(before) || before >= 0x80) && (IsASCIILetter(after) || after >= 0x80);
+}
+
+template <typename Unit>
+bool IsLineStart(const Unit *text, size_t position) {
+  return position == 0 || UnitAt(text, position - 1) == '\n';
+}
+
+// Returns true if the text has an ASCII string at a position. Letters of
+// the text are taken as lowercase when the case is ignored.
+template <typename Unit>
+bool HasString(const Unit *text, size_t length, size_t position, const char *string, bool ignoreCase) {
+  for (; *string; string++, position++) {
+    if (position >= length) {
+      return false;
+    }
+
+    uint32_t c = UnitAt(text, position);
+    if ((ignoreCase ? ToASCIILower(c) : c) != static_cast<unsigned char>(*string)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Returns the position after the first occurrence of a string from a
+// position, or the length of the text if there is none.
+template <typename Unit>
+size_t SkipPast(const Unit *text, size_t length, size_t position, const char *string, bool ignoreCase) {
+  for (; position < length; position++) {
+    if (UnitAt(text, position) == static_cast<unsigned char>(*string) || ignoreCase) {
+      if (HasString(text, length, position, string, ignoreCase)) {
+        return position + strlen(string);
+      }
+    }
+  }
+
+  return length;
+}
+
+// Returns the position of the newline ending the line at a position, or the
+// length of the text.
+template <typename Unit>
+size_t FindLineEnd(const Unit *text, size_t length, size_t position) {
+  while (position < length && UnitAt(text, position) != '\n') {
+    position++;
+  }
+
+  return position;
+}
+
+// Reads a name of ASCII letters, and digits if allowed, and returns its end.
+template <typename Unit>
+size_t ReadName(const Unit *text, size_t length, size_t position, bool digits, bool ignoreCase, std::string *name) {
+  name->clear();
+
+  for (; position < length; position++) {
+    uint32_t c = UnitAt(text, position);
+    if (!IsASCIILetter(c) && !(digits && IsASCIIDigit(c))) {
+      break;
+    }
+
+    name->push_back(static_cast<char>(ignoreCase ? ToASCIILower(c) : c));
+  }
+
+  return position;
+}
+
+bool IsOneOf(const std::string& name, const char *const *names, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    if (name == names[i]) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Returns the end of a character reference at a position, such as &eacute;
+// or &#233;, or the position if there is none.
+template <typename Unit>
+size_t SkipCharacterReference(const Unit *text, size_t length, size_t position) {
+  size_t i = position + 1;
+  if (i < length && UnitAt(text, i) == '#') {
+    i++;
+  }
+
+  size_t name = i;
+  while (i < length && i - name < 32 && (IsASCIILetter(UnitAt(text, i)) || IsASCIIDigit(UnitAt(text, i)))) {
+    i++;
+  }
+
+  if (i == name || i >= length || UnitAt(text, i) != ';') {
+    return position;
+  }
+
+  return i + 1;
+}
+
+// HTML.
+
+// The elements whose content is code rather than text.
+const char *const kHTMLCodeElements[] = {
+  "code", "kbd", "listing", "math", "pre", "samp", "script", "style", "var", "xmp",
+};
+
+// Skips the rest of a tag from a position after its name, and returns the
+// position after it. If the text of attributes is checked, it stops after
+// the opening quote of the value of an alt or title attribute instead, and
+// sets *attributeQuote to the quote.
+template <typename Unit>
+size_t SkipHTMLTag(const Unit *text, size_t length, size_t position, bool textAttributes, uint32_t *attributeQuote) {
+  // The last attribute name, and whether an '=' followed it.
+  size_t nameStart = position, nameEnd = position;
+  bool assigned = false;
+
+  while (position < length) {
+    uint32_t c = UnitAt(text, position);
+
+    if (c == '>') {
+      return position + 1;
+    }
+
+    if (c == '"' || c == '\'') {
+      size_t nameLength = nameEnd - nameStart;
+      if (textAttributes && assigned &&
+          ((nameLength == 3 && HasString(text, length, nameStart, "alt", true)) ||
+           (nameLength == 5 && HasString(text, length, nameStart, "title", true)))) {
+        *attributeQuote = c;
+        return position + 1;
+      }
+
+      position++;
+      while (position < length && UnitAt(text, position) != c) {
+        position++;
+      }
+
+      position++;
+      assigned = false;
+      continue;
+    }
+
+    if (c == '=') {
+      assigned = true;
+    } else if (IsASCIILetter(c) || IsASCIIDigit(c) || c == '-' || c == ':') {
+      if (position != nameEnd) {
+        nameStart = position;
+      }
+
+      nameEnd = position + 1;
+      assigned = false;
+    } else if (!IsBlank(c) && c != '\n' && c != '\r') {
+      assigned = false;
+    }
+
+    position++;
+  }
+
+  return length;
+}
+
+// Finds the first tag, comment or character reference from a position.
+// Elements holding code, such as pre, are skipped with their content, and
+// the values of alt and title attributes are checked as text.
+template <typename Unit>
+bool FindHTMLMarkup(const Unit *text, size_t length, size_t from, size_t *start, size_t *end, bool *joining, uint32_t *attributeQuote) {
+  *joining = false;
+
+  if (*attributeQuote) {
+    size_t i = from;
+    while (i < length && UnitAt(text, i) != *attributeQuote) {
+      i++;
+    }
+
+    if (i == length) {
+      return false;
+    }
+
+    *attributeQuote = 0;
+    *start = i;
+    *end = SkipHTMLTag(text, length, i + 1, true, attributeQuote);
+    return true;
+  }
+
+  std::string name;
+  for (size_t i = from; i < length; i++) {
+    uint32_t c = UnitAt(text, i);
+
+    if (c == '&') {
+      size_t referenceEnd = SkipCharacterReference(text, length, i);
+      if (referenceEnd > i) {
+        *start = i;
+        *end = referenceEnd;
+        *joining = true;
+        return true;
+      }
+    }
+
+    if (c != '<' || i + 1 >= length) {
+      continue;
+    }
+
+    if (HasString(text, length, i, "<!--", false)) {
+      *start = i;
+      *end = SkipPast(text, length, i + 4, "-->", false);
+      return true;
+    }
+
+    if (HasString(text, length, i, "<![cdata[", true)) {
+      *start = i;
+      *end = SkipPast(text, length, i + 9, "]]>", false);
+      return true;
+    }
+
+    // Anything else starting with '<' is text, such as "a < b".
+    uint32_t next = UnitAt(text, i + 1);
+    bool closing = next == '/';
+    if (!IsASCIILetter(closing && i + 2 < length ? UnitAt(text, i + 2) : next) && next != '!' && next != '?') {
+      continue;
+    }
+
+    size_t nameEnd = ReadName(text, length, i + (closing ? 2 : 1), true, true, &name);
+    bool code = !closing && IsOneOf(name, kHTMLCodeElements, sizeof(kHTMLCodeElements) / sizeof(kHTMLCodeElements[0]));
+
+    *start = i;
+    *end = SkipHTMLTag(text, length, nameEnd, !code, attributeQuote);
+
+    if (code) {
+      std::string endTag = "</" + name;
+      *end = SkipPast(text, length, *end, endTag.c_str(), true);
+      *end = SkipHTMLTag(text, length, *end, false, attributeQuote);
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+// LaTeX.
+
+// The commands whose arguments are not text, with the number of them.
+struct LaTeXCommand {
+  const char *name;
+  int arguments;
+};
+
+const LaTeXCommand kLaTeXCommands[] = {
+  {"addcontentsline", 2}, {"addtocounter", 2}, {"addtolength", 2}, {"autoref", 1},
+  {"bibitem", 1}, {"bibliography", 1}, {"bibliographystyle", 1}, {"cite", 1},
+  {"citep", 1}, {"citet", 1}, {"color", 1}, {"colorbox", 1}, {"cref", 1},
+  {"definecolor", 3}, {"documentclass", 1}, {"end", 1}, {"eqref", 1}, {"hspace", 1},
+  {"href", 1}, {"hyphenation", 1}, {"include", 1}, {"includegraphics", 1},
+  {"includeonly", 1}, {"input", 1}, {"label", 1}, {"newcommand", 2},
+  {"newenvironment", 3}, {"newtheorem", 2}, {"nocite", 1}, {"pageref", 1},
+  {"pagenumbering", 1}, {"pagestyle", 1}, {"providecommand", 2}, {"ref", 1},
+  {"renewcommand", 2}, {"selectlanguage", 1}, {"setcounter", 2}, {"setlength", 2},
+  {"textcolor", 1}, {"thispagestyle", 1}, {"url", 1}, {"usepackage", 1},
+  {"vspace", 1},
+};
+
+// The environments whose content is code or math rather than text.
+const char *const kLaTeXCodeEnvironments[] = {
+  "align", "align*", "comment", "displaymath", "eqnarray", "eqnarray*", "equation",
+  "equation*", "gather", "gather*", "lstlisting", "math", "minted", "multline",
+  "multline*", "verbatim", "verbatim*",
+};
+
+int GetLaTeXArgumentCount(const std::string& name) {
+  for (size_t i = 0; i < sizeof(kLaTeXCommands) / sizeof(kLaTeXCommands[0]); i++) {
+    if (name == kLaTeXCommands[i].name) {
+      return kLaTeXCommands[i].arguments;
+    }
+  }
+
+  return 0;
+}
+
+// Skips a group from its opening bracket to the matching closing one.
+template <typename Unit>
+size_t SkipLaTeXGroup(const Unit *text, size_t length, size_t position, uint32_t open, uint32_t close) {
+  int depth = 0;
+
+  for (; position < length; position++) {
+    uint32_t c = UnitAt(text, position);
+
+    if (c == '\\') {
+      position++;
+    } else if (c == open) {
+      depth++;
+    } else if (c == close && --depth == 0) {
+      return position + 1;
+    }
+  }
+
+  return length;
+}
+
+// Skips a number of arguments in braces after a command, and the optional
+// arguments in brackets before them.
+template <typename Unit>
+size_t SkipLaTeXArguments(const Unit *text, size_t length, size_t position, int count) {
+  if (position < length && UnitAt(text, position) == '*') {
+    position++;
+  }
+
+  while (count > 0) {
+    size_t i = position;
+    while (i < length && IsBlank(UnitAt(text, i))) {
+      i++;
+    }
+
+    if (i < length && UnitAt(text, i) == '[') {
+      position = SkipLaTeXGroup(text, length, i, '[', ']');
+    } else if (i < length && UnitAt(text, i) == '{') {
+      position = SkipLaTeXGroup(text, length, i, '{', '}');
+      count--;
+    } else {
+      break;
+    }
+  }
+
+  return position;
+}
+
+// Finds the first command, comment or math from a position. Environments
+// holding code or math, such as verbatim, are skipped with their content,
+// and so are the arguments of commands that are not text, such as \ref.
+template <typename Unit>
+bool FindLaTeXMarkup(const Unit *text, size_t length, size_t from, size_t *start, size_t *end, bool *joining) {
+  *joining = false;
+
+  std::string name;
+  for (size_t i = from; i < length; i++) {
+    uint32_t c = UnitAt(text, i);
+
+    if (c == '%') {
+      *start = i;
+      *end = FindLineEnd(text, length, i);
+      return true;
+    }
+
+    if (c == '$') {
+      size_t j = i + 1;
+      bool display = j < length && UnitAt(text, j) == '$';
+
+      if (display) {
+        j = SkipPast(text, length, j + 1, "$$", false);
+      } else {
+        while (j < length && UnitAt(text, j) != '$') {
+          j += UnitAt(text, j) == '\\' ? 2 : 1;
+        }
+
+        j = j < length ? j + 1 : length;
+      }
+
+      *start = i;
+      *end = j;
+      return true;
+    }
+
+    if (c != '\\' || i + 1 >= length) {
+      continue;
+    }
+
+    uint32_t next = UnitAt(text, i + 1);
+    *start = i;
+
+    if (IsASCIILetter(next)) {
+      size_t nameEnd = ReadName(text, length, i + 1, false, false, &name);
+
+      if (name == "begin") {
+        size_t braceEnd = SkipLaTeXArguments(text, length, nameEnd, 1);
+        std::string environment;
+        for (size_t j = nameEnd; j < braceEnd; j++) {
+          uint32_t e = UnitAt(text, j);
+          if (IsASCIILetter(e) || e == '*') {
+            environment.push_back(static_cast<char>(e));
+          }
+        }
+
+        if (IsOneOf(environment, kLaTeXCodeEnvironments, sizeof(kLaTeXCodeEnvironments) / sizeof(kLaTeXCodeEnvironments[0]))) {
+          std::string endCommand = "\\end{" + environment + "}";
+          *end = SkipPast(text, length, braceEnd, endCommand.c_str(), false);
+        } else {
+          // The column specification of tables follows their name.
+          bool table = environment == "tabular" || environment == "array";
+          *end = SkipLaTeXArguments(text, length, braceEnd, table ? 1 : 0);
+        }
+      } else if (name == "verb" || name == "lstinline") {
+        size_t j = nameEnd;
+        if (j < length && UnitAt(text, j) == '*') {
+          j++;
+        }
+
+        if (j < length) {
+          uint32_t delimiter = UnitAt(text, j) == '{' ? '}' : UnitAt(text, j);
+          for (j++; j < length && UnitAt(text, j) != delimiter; j++) {
+          }
+        }
+
+        *end = j < length ? j + 1 : length;
+      } else {
+        *end = SkipLaTeXArguments(text, length, nameEnd, GetLaTeXArgumentCount(name));
+      }
+    } else if (next == '(') {
+      *end = SkipPast(text, length, i + 2, "\\)", false);
+    } else if (next == '[') {
+      *end = SkipPast(text, length, i + 2, "\\]", false);
+    } else if (next < 0x80 && next != 0 && strchr("'`^\"~=.", static_cast<int>(next))) {
+      // Accents go on the letter after them, which may be in braces.
+      *end = i + 2;
+      if (i + 4 < length && UnitAt(text, i + 2) == '{' && UnitAt(text, i + 4) == '}') {
+        *end = i + 5;
+      }
+
+      *joining = true;
+    } else {
+      // Hyphenation points and italic corrections can be inside words,
+      // while other escapes, such as \% or \\, are text of their own.
+      *end = i + 2;
+      *joining = (next == '-' || next == '/') && IsBetweenLetters(text, length, i, *end);
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+// Markdown.
+
+// Returns the end of a fenced code block opened on the line at a position,
+// at the end of its closing fence, or the position if the line opens none.
+template <typename Unit>
+size_t SkipFencedCode(const Unit *text, size_t length, size_t position) {
+  size_t i = position;
+  while (i < length && i - position < 3 && UnitAt(text, i) == ' ') {
+    i++;
+  }
+
+  if (i >= length || (UnitAt(text, i) != '`' && UnitAt(text, i) != '~')) {
+    return position;
+  }
+
+  uint32_t fence = UnitAt(text, i);
+  size_t fenceStart = i;
+  while (i < length && UnitAt(text, i) == fence) {
+    i++;
+  }
+
+  size_t fenceLength = i - fenceStart;
+  if (fenceLength < 3) {
+    return position;
+  }
+
+  // The closing fence is a line of at least as many of the same characters.
+  for (size_t line = FindLineEnd(text, length, i); line < length;) {
+    size_t j = ++line;
+    while (j < length && j - line < 3 && UnitAt(text, j) == ' ') {
+      j++;
+    }
+
+    size_t closeStart = j;
+    while (j < length && UnitAt(text, j) == fence) {
+      j++;
+    }
+
+    size_t lineEnd = FindLineEnd(text, length, j);
+    if (j - closeStart >= fenceLength) {
+      while (j < lineEnd && (IsBlank(UnitAt(text, j)) || UnitAt(text, j) == '\r')) {
+        j++;
+      }
+
+      if (j == lineEnd) {
+        return lineEnd;
+      }
+    }
+
+    line = lineEnd;
+  }
+
+  return length;
+}
+
+// Returns true if the line after the newline at a position is blank.
+template <typename Unit>
+bool IsParagraphEnd(const Unit *text, size_t length, size_t position) {
+  if (UnitAt(text, position) != '\n') {
+    return false;
+  }
+
+  for (position++; position < length && (IsBlank(UnitAt(text, position)) || UnitAt(text, position) == '\r'); position++) {
+  }
+
+  return position < length && UnitAt(text, position) == '\n';
+}
+
+// Returns the end of a link reference definition, such as
+// "[label]: http://example.com", on the line at a position, or the position.
+template <typename Unit>
+size_t SkipLinkDefinition(const Unit *text, size_t length, size_t position) {
+  size_t i = position;
+  while (i < length && i - position < 3 && UnitAt(text, i) == ' ') {
+    i++;
+  }
+
+  if (i >= length || UnitAt(text, i) != '[') {
+    return position;
+  }
+
+  while (i < length && UnitAt(text, i) != ']' && UnitAt(text, i) != '\n') {
+    i++;
+  }
+
+  if (i + 1 >= length || UnitAt(text, i) != ']' || UnitAt(text, i + 1) != ':') {
+    return position;
+  }
+
+  return FindLineEnd(text, length, i);
+}
+
+// Finds the first code span or block, link destination, tag or character
+// reference from a position.
+template <typename Unit>
+bool FindMarkdownMarkup(const Unit *text, size_t length, size_t from, size_t *start, size_t *end, bool *joining) {
+  *joining = false;
+
+  for (size_t i = from; i < length; i++) {
+    uint32_t c = UnitAt(text, i);
+
+    if (IsLineStart(text, i)) {
+      size_t blockEnd = SkipFencedCode(text, length, i);
+      if (blockEnd == i) {
+        blockEnd = SkipLinkDefinition(text, length, i);
+      }
+
+      if (blockEnd > i) {
+        *start = i;
+        *end = blockEnd;
+        return true;
+      }
+    }
+
+    if (c == '`') {
+      // A code span ends at the next run of as many backticks.
+      size_t run = i;
+      while (run < length && UnitAt(text, run) == '`') {
+        run++;
+      }
+
+      // Code spans do not run across paragraphs.
+      size_t runLength = run - i;
+      for (size_t j = run; j < length && !IsParagraphEnd(text, length, j);) {
+        size_t closeStart = j;
+        while (j < length && UnitAt(text, j) == '`') {
+          j++;
+        }
+
+        if (j - closeStart == runLength) {
+          *start = i;
+          *end = j;
+          return true;
+        }
+
+        if (j == closeStart) {
+          j++;
+        }
+      }
+
+      i = run - 1;
+    } else if (c == '<' && i + 1 < length) {
+      // Tags, comments and autolinks, such as <https://example.com>.
+      uint32_t next = UnitAt(text, i + 1);
+      if (!IsASCIILetter(next) && next != '/' && next != '!') {
+        continue;
+      }
+
+      size_t j = i + 1;
+      while (j < length && UnitAt(text, j) != '>' && UnitAt(text, j) != '<' && UnitAt(text, j) != '\n') {
+        j++;
+      }
+
+      if (j < length && UnitAt(text, j) == '>') {
+        *start = i;
+        *end = HasString(text, length, i, "<!--", false) ? SkipPast(text, length, i + 4, "-->", false) : j + 1;
+        return true;
+      }
+    } else if (c == '&') {
+      size_t referenceEnd = SkipCharacterReference(text, length, i);
+      if (referenceEnd > i) {
+        *start = i;
+        *end = referenceEnd;
+        *joining = true;
+        return true;
+      }
+    } else if (c == ']' && i + 1 < length && UnitAt(text, i + 1) == '(') {
+      // The destination of a link or image, after its text.
+      int depth = 0;
+      for (size_t j = i + 1; j < length && UnitAt(text, j) != '\n'; j++) {
+        uint32_t d = UnitAt(text, j);
+        if (d == '(') {
+          depth++;
+        } else if (d == ')' && --depth == 0) {
+          *start = i + 1;
+          *end = j + 1;
+          return true;
+        }
+      }
+    }
+  }
+
+  return false;
+}
+
+// Man pages.
+
+// The requests whose arguments are not text.
+const char *const kManRequests[] = {
+  "ad", "bp", "br", "de", "ds", "el", "fi", "ft", "hy", "ie", "if", "in", "ll", "na",
+  "ne", "nf", "nh", "nr", "PD", "ps", "RE", "RS", "so", "sp", "ta", "TH", "ti",
+};
+
+// The requests starting blocks of code, such as examples, and those ending
+// them.
+const char *const kManBlocks[][2] = {
+  {"EX", "EE"},
+  {"nf", "fi"},
+  {"de", "."},
+};
+
+// Returns the end of the name of the request on the line at a position, or
+// the position if the line is text.
+template <typename Unit>
+size_t ReadManRequest(const Unit *text, size_t length, size_t position, size_t *nameStart) {
+  if (position >= length || (UnitAt(text, position) != '.' && UnitAt(text, position) != '\'')) {
+    return position;
+  }
+
+  size_t i = position + 1;
+  while (i < length && IsBlank(UnitAt(text, i))) {
+    i++;
+  }
+
+  *nameStart = i;
+  while (i < length && !IsBlank(UnitAt(text, i)) && UnitAt(text, i) != '\n' && UnitAt(text, i) != '\r') {
+    i++;
+  }
+
+  return i;
+}
+
+template <typename Unit>
+bool HasName(const Unit *text, size_t length, size_t start, size_t end, const char *name) {
+  return end - start == strlen(name) && HasString(text, length, start, name, false);
+}
+
+// Skips the argument of an escape, one character, two after '(' or any in
+// brackets.
+template <typename Unit>
+size_t SkipManEscapeArgument(const Unit *text, size_t length, size_t position) {
+  if (position >= length) {
+    return length;
+  }
+
+  if (UnitAt(text, position) == '(') {
+    return position + 3 < length ? position + 3 : length;
+  }
+
+  if (UnitAt(text, position) == '[') {
+    while (position < length && UnitAt(text, position) != ']' && UnitAt(text, position) != '\n') {
+      position++;
+    }
+
+    return position < length && UnitAt(text, position) == ']' ? position + 1 : position;
+  }
+
+  return position + 1;
+}
+
+// Finds the first request, escape or comment from a position. The arguments
+// of requests such as .SH and .B are text, those of requests such as .TH are
+// skipped, and so are examples and other unfilled blocks.
+template <typename Unit>
+bool FindManMarkup(const Unit *text, size_t length, size_t from, size_t *start, size_t *end, bool *joining) {
+  *joining = false;
+
+  for (size_t i = from; i < length; i++) {
+    uint32_t c = UnitAt(text, i);
+
+    size_t nameStart = i;
+    size_t nameEnd = IsLineStart(text, i) ? ReadManRequest(text, length, i, &nameStart) : i;
+    if (nameEnd > i) {
+      *start = i;
+      *end = nameEnd;
+
+      if (HasString(text, length, nameStart, "\\\"", false)) {
+        *end = FindLineEnd(text, length, i);
+        return true;
+      }
+
+      for (size_t block = 0; block < sizeof(kManBlocks) / sizeof(kManBlocks[0]); block++) {
+        if (!HasName(text, length, nameStart, nameEnd, kManBlocks[block][0])) {
+          continue;
+        }
+
+        for (size_t line = FindLineEnd(text, length, i); line < length; line = FindLineEnd(text, length, line + 1)) {
+          size_t closeStart = line + 1;
+          size_t closeEnd = ReadManRequest(text, length, line + 1, &closeStart);
+          if (closeEnd > line + 1 && HasName(text, length, closeStart, closeEnd, kManBlocks[block][1])) {
+            *end = closeEnd;
+            return true;
+          }
+        }
+
+        *end = length;
+        return true;
+      }
+
+      std::string name;
+      for (size_t j = nameStart; j < nameEnd; j++) {
+        name.push_back(static_cast<char>(UnitAt(text, j)));
+      }
+
+      if (IsOneOf(name, kManRequests, sizeof(kManRequests) / sizeof(kManRequests[0]))) {
+        *end = FindLineEnd(text, length, i);
+      }
+
+      return true;
+    }
+
+    if (c != '\\' || i + 1 >= length) {
+      continue;
+    }
+
+    uint32_t next = UnitAt(text, i + 1);
+    *start = i;
+
+    switch (next) {
+      case '"':
+      case '#':
+        *end = FindLineEnd(text, length, i);
+        break;
+
+      case 'f':
+        // Font changes are sometimes inside words.
+        *end = SkipManEscapeArgument(text, length, i + 2);
+        *joining = IsBetweenLetters(text, length, i, *end);
+        break;
+
+      case 's': {
+        size_t j = i + 2;
+        if (j < length && (UnitAt(text, j) == '+' || UnitAt(text, j) == '-')) {
+          j++;
+        }
+
+        if (j < length && (UnitAt(text, j) == '(' || UnitAt(text, j) == '[')) {
+          j = SkipManEscapeArgument(text, length, j);
+        } else {
+          while (j < length && IsASCIIDigit(UnitAt(text, j))) {
+            j++;
+          }
+        }
+
+        *end = j;
+        *joining = IsBetweenLetters(text, length, i, *end);
+        break;
+      }
+
+      case '&':
+      case 'c':
+      case ':':
+      case ')':
+        // Characters of no width.
+        *end = i + 2;
+        *joining = IsBetweenLetters(text, length, i, *end);
+        break;
+
+      case '(':
+      case '[':
+        // Special characters, of which the quotes can be inside words.
+        *end = SkipManEscapeArgument(text, length, i + 1);
+        *joining = (HasString(text, length, i + 2, "aq", false) || HasString(text, length, i + 2, "cq", false)) && IsBetweenLetters(text, length, i, *end);
+        break;
+
+      case '*':
+        *end = SkipManEscapeArgument(text, length, i + 2);
+        break;
+
+      default:
+        *end = i + 2;
+        break;
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+// Source code.
+
+bool IsIdentifierUnit(uint32_t c) {
+  return IsASCIILetter(c) || IsASCIIDigit(c) || c == '_' || c >= 0x80;
+}
+
+bool IsHexDigit(uint32_t c) {
+  return IsASCIIDigit(c) || (ToASCIILower(c) >= 'a' && ToASCIILower(c) <= 'f');
+}
+
+// Returns true if a unit can be in a URL or a path, which run up to
+// whitespace, quotes, brackets or separators of arguments.
+bool IsPathUnit(uint32_t c) {
+  return c > ' ' && (c >= 0x80 || !strchr("\"'`<>()[]{},;|", static_cast<int>(c)));
+}
+
+// Returns true if a path can start at a position, after whitespace, an
+// opening quote or bracket, or an equals sign.
+template <typename Unit>
+bool IsPathStart(const Unit *text, size_t position) {
+  if (position == 0) {
+    return true;
+  }
+
+  uint32_t c = UnitAt(text, position - 1);
+  return c <= ' ' || strchr("\"'`<([{=,", static_cast<int>(c));
+}
+
+template <typename Unit>
+size_t SkipPathUnits(const Unit *text, size_t length, size_t position) {
+  while (position < length && IsPathUnit(UnitAt(text, position))) {
+    position++;
+  }
+
+  return position;
+}
+
+// Returns the end of a UUID at a position, such as
+// 123e4567-e89b-12d3-a456-426614174000, or the position if there is none.
+template <typename Unit>
+size_t SkipUUID(const Unit *text, size_t length, size_t position) {
+  static const size_t kGroupLengths[] = {8, 4, 4, 4, 12};
+
+  size_t i = position;
+  for (size_t group = 0; group < sizeof(kGroupLengths) / sizeof(kGroupLengths[0]); group++) {
+    if (group > 0) {
+      if (i >= length || UnitAt(text, i) != '-') {
+        return position;
+      }
+
+      i++;
+    }
+
+    for (size_t j = 0; j < kGroupLengths[group]; j++, i++) {
+      if (i >= length || !IsHexDigit(UnitAt(text, i))) {
+        return position;
+      }
+    }
+  }
+
+  return i < length && IsIdentifierUnit(UnitAt(text, i)) ? position : i;
+}
+
+// Returns the end of a hash at a position, such as a commit id or a
+// checksum, taken as at least 7 hex digits with a digit among them, or the
+// position if there is none.
+template <typename Unit>
+size_t SkipHash(const Unit *text, size_t length, size_t position) {
+  size_t i = position;
+  bool digits = false;
+  while (i < length && IsHexDigit(UnitAt(text, i))) {
+    digits = digits || IsASCIIDigit(UnitAt(text, i));
+    i++;
+  }
+
+  if (i - position < 7 || !digits || (i < length && IsIdentifierUnit(UnitAt(text, i)))) {
+    return position;
+  }
+
+  return i;
+}
+
+// Returns the end of a path at a position, either absolute, relative to the
+// current or home directory, on a drive, or made of names with a slash
+// between them and ending in a file name with an extension or another
+// slash, such as src/main.cc or a/b/c. Returns the position if there is
+// none.
+template <typename Unit>
+size_t SkipPath(const Unit *text, size_t length, size_t position) {
+  uint32_t c = UnitAt(text, position);
+  uint32_t next = position + 1 < length ? UnitAt(text, position + 1) : 0;
+
+  if ((c == '/' && (IsIdentifierUnit(next) || next == '.')) ||
+      (c == '~' && next == '/') ||
+      HasString(text, length, position, "./", false) ||
+      HasString(text, length, position, "../", false) ||
+      (IsASCIILetter(c) && next == ':' && position + 2 < length && (UnitAt(text, position + 2) == '\\' || UnitAt(text, position + 2) == '/'))) {
+    return SkipPathUnits(text, length, position);
+  }
+
+  if (!IsIdentifierUnit(c) && c != '@') {
+    return position;
+  }
+
+  size_t end = SkipPathUnits(text, length, position);
+
+  size_t slashes = 0;
+  bool extension = false;
+  for (size_t i = position; i < end; i++) {
+    uint32_t unit = UnitAt(text, i);
+    if (unit == '/') {
+      slashes++;
+      extension = false;
+    } else if (unit == '.' && i + 1 < end && IsASCIILetter(UnitAt(text, i + 1))) {
+      extension = true;
+    }
+  }
+
+  return slashes >= 2 || (slashes == 1 && extension) ? end : position;
+}
+
+// Returns the end of a URL at a position, with a scheme such as https: or
+// starting with www., or the position if there is none.
+template <typename Unit>
+size_t SkipURL(const Unit *text, size_t length, size_t position) {
+  if (HasString(text, length, position, "www.", true)) {
+    return SkipPathUnits(text, length, position);
+  }
+
+  size_t i = position;
+  while (i < length && (IsASCIILetter(UnitAt(text, i)) || IsASCIIDigit(UnitAt(text, i)) ||
+      UnitAt(text, i) == '+' || UnitAt(text, i) == '.' || UnitAt(text, i) == '-')) {
+    i++;
+  }
+
+  if (i == position || !HasString(text, length, i, "://", false)) {
+    return position;
+  }
+
+  return SkipPathUnits(text, length, i + 3);
+}
+
+// Finds the first literal from a position that is not made of words: a
+// number, such as 0xFF or 1e-9, a UUID, a hash, a URL or a path. The words
+// of identifiers are left to the segmenter to split.
+template <typename Unit>
+bool FindCodeMarkup(const Unit *text, size_t length, size_t from, size_t *start, size_t *end, bool *joining) {
+  *joining = false;
+
+  for (size_t i = from; i < length; i++) {
+    uint32_t c = UnitAt(text, i);
+    if (i > 0 && IsIdentifierUnit(UnitAt(text, i - 1))) {
+      continue;
+    }
+
+    size_t j = i;
+    if (IsHexDigit(c)) {
+      j = SkipUUID(text, length, i);
+    }
+
+    if (j == i && IsASCIIDigit(c)) {
+      j = i + 1;
+      while (j < length && (IsIdentifierUnit(UnitAt(text, j)) ||
+          (UnitAt(text, j) == '.' && j + 1 < length && IsASCIIDigit(UnitAt(text, j + 1))) ||
+          ((UnitAt(text, j) == '+' || UnitAt(text, j) == '-') && ToASCIILower(UnitAt(text, j - 1)) == 'e' && j + 1 < length && IsASCIIDigit(UnitAt(text, j + 1))))) {
+        j++;
+      }
+    }
+
+    if (j == i && IsHexDigit(c)) {
+      j = SkipHash(text, length, i);
+    }
+
+    if (j == i && IsASCIILetter(c)) {
+      j = SkipURL(text, length, i);
+    }
+
+    if (j == i && IsPathStart(text, i)) {
+      j = SkipPath(text, length, i);
+    }
+
+    if (j > i) {
+      *start = i;
+      *end = j;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace
+
+MarkupScanner::MarkupScanner(TextFormat format) : format(format), joined(false), attributeQuote(0) {
+}
+
+bool MarkupScanner::NextSpan(const uint16_t *text, size_t length, size_t *position, TextSpan *span) {
+  return FindSpan(text, length, position, span);
+}
+
+bool MarkupScanner::NextSpan(const char *text, size_t length, size_t *position, TextSpan *span) {
+  return FindSpan(text, length, position, span);
+}
+
+template <typename Unit>
+bool MarkupScanner::FindSpan(const Unit *text, size_t length, size_t *position, TextSpan *span) {
+  while (*position < length) {
+    size_t start = *position, markupStart, markupEnd;
+    bool joining, found;
+
+    switch (format) {
+      case HTML_FORMAT:
+        found = FindHTMLMarkup(text, length, start, &markupStart, &markupEnd, &joining, &attributeQuote);
+        break;
+      case LATEX_FORMAT:
+        found = FindLaTeXMarkup(text, length, start, &markupStart, &markupEnd, &joining);
+        break;
+      case MARKDOWN_FORMAT:
+        found = FindMarkdownMarkup(text, length, start, &markupStart, &markupEnd, &joining);
+        break;
+      case MAN_FORMAT:
+        found = FindManMarkup(text, length, start, &markupStart, &markupEnd, &joining);
+        break;
+      case SOURCE_CODE_FORMAT:
+        found = FindCodeMarkup(text, length, start, &markupStart, &markupEnd, &joining);
+        break;
+      default:
+        found = false;
+        break;
+    }
+
+    if (!found) {
+      markupStart = markupEnd = length;
+      joining = false;
+    }
+
+    bool joinedBefore = joined;
+    joined = joining;
+    *position = markupEnd > markupStart || !found ? markupEnd : markupStart + 1;
+
+    if (markupStart > start) {
+      span->start = start;
+      span->end = markupStart;
+      span->joinedBefore = joinedBefore;
+      span->joinedAfter = joining;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace spellchecker
@@ -0,0 +1,68 @@
+#ifndef SRC_MARKUP_SCANNER_H_
+#define SRC_MARKUP_SCANNER_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+
+namespace spellchecker {
+
+// The formats text can be checked in. The tags, commands and code of the
+// markup formats are skipped. In source code, literals such as numbers,
+// URLs and paths are skipped, and identifiers are split into their words.
+enum TextFormat {
+  PLAIN_TEXT_FORMAT,
+  HTML_FORMAT,
+  LATEX_FORMAT,
+  MARKDOWN_FORMAT,
+  MAN_FORMAT,
+  SOURCE_CODE_FORMAT,
+};
+
+// A part of a text between markup, to be checked as text.
+struct TextSpan {
+  size_t start;
+  size_t end;
+
+  // Whether the markup before or after the span can be inside a word, such
+  // as an HTML character reference or a LaTeX accent, rather than end it.
+  bool joinedBefore;
+  bool joinedAfter;
+
+  // Returns true if a word found in the span may be cut short by such
+  // markup, so it is only part of a word and is not checked.
+  bool IsCut(size_t word_start, size_t word_end) const
+  {
+    return (joinedBefore && word_start == start) || (joinedAfter && word_end == end);
+  }
+};
+
+// Finds the parts of a text to check, skipping its markup in one pass, with
+// their positions in the whole text so the misspelled words need no mapping
+// back. Text in UTF-16, Latin-1 or UTF-8 units is scanned the same way, as
+// the markup of every format is ASCII.
+class MarkupScanner {
+public:
+  explicit MarkupScanner(TextFormat format);
+
+  // Finds the next part of the text to check from *position, which is moved
+  // past it and the markup after it. Returns false at the end of the text.
+  bool NextSpan(const uint16_t *text, size_t length, size_t *position, TextSpan *span);
+  bool NextSpan(const char *text, size_t length, size_t *position, TextSpan *span);
+
+private:
+  template <typename Unit>
+  bool FindSpan(const Unit *text, size_t length, size_t *position, TextSpan *span);
+
+  TextFormat format;
+
+  // Whether the markup before the next span can be inside a word.
+  bool joined;
+
+  // While in the value of an HTML attribute holding text, such as alt, the
+  // quote that ends it, and 0 otherwise.
+  uint32_t attributeQuote;
+};
+
+}  // namespace spellchecker
+
+#endif  // SRC_MARKUP_SCANNER_H_
@@ -5,6 +5,9 @@
 #include <vector>
 #include <memory>
 #include <stdint.h>
+#include "code_page.h"
+#include "markup_scanner.h"
+#include "ignore_patterns.h"
 
 namespace spellchecker {
 
@@ -17,8 +20,64 @@ struct MisspelledRange {
   size_t end;
 };
 
+// A word of a batch, as the range of its UTF-8 bytes in a buffer.
+struct WordRange {
+  size_t start;
+  size_t end;
+};
+
+// The counters of a cache of the spellchecker.
+struct CacheStats {
+  uint64_t hits;
+  uint64_t misses;
+
+  // The number of entries held.
+  size_t size;
+};
+
+// The strategies of finding corrections that can be skipped, to find them
+// sooner.
+const int SKIP_NGRAM_SUGGESTIONS = 1 << 0;
+const int SKIP_PHONETIC_SUGGESTIONS = 1 << 1;
+const int SKIP_TWO_WORD_SUGGESTIONS = 1 << 2;
+const int SKIP_COMPOUND_SUGGESTIONS = 1 << 3;
+
+// The limits of a search for corrections, none by default.
+struct SuggestionOptions {
+  SuggestionOptions() : timeout(0), maxSuggestions(0), skip(0)
+  {
+    //
+  }
+
+  // In milliseconds of wall-clock time. The corrections found by then are
+  // returned.
+  double timeout;
+
+  size_t maxSuggestions;
+
+  // SKIP_*_SUGGESTIONS flags.
+  int skip;
+};
+
+// The encodings text can be checked in besides UTF-16. The ranges found are
+// still counted in UTF-16 units, as indexes into the JavaScript string with
+// the same text.
+enum TextEncoding {
+  LATIN1_TEXT,
+  UTF8_TEXT,
+};
+
 class SpellcheckerImplementation;
 
+inline void DecodeTextToUTF16(const char *text, size_t length, TextEncoding encoding, std::vector<uint16_t> *utf16_text)
+{
+  if (encoding == UTF8_TEXT) {
+    DecodeUTF8ToUTF16(text, length, utf16_text);
+  } else {
+    DecodeLatin1ToUTF16(text, length, utf16_text);
+  }
+}
+
 class SpellcheckerThreadView {
 public:
   SpellcheckerThreadView(SpellcheckerImplementation *impl) : impl{impl}
@@ -33,6 +92,28 @@ public:
 
   virtual std::vector<MisspelledRange> CheckSpelling(const uint16_t *text, size_t length);
 
+  // Checks the text into the given ranges, reusing their storage so that a
+  // view checking text after text does not allocate for each one.
+  virtual void CheckSpelling(const uint16_t *text, size_t length, std::vector<MisspelledRange> *ranges);
+
+  // Checks Latin-1 or UTF-8 text into the given ranges. Unless overridden,
+  // the text is converted to UTF-16 first.
+  virtual void CheckSpelling(const char *text, size_t length, TextEncoding encoding, std::vector<MisspelledRange> *ranges);
+
+  // Checks text in a markup format into the given ranges, as CheckSpelling
+  // of the implementation does.
+  virtual void CheckSpelling(const uint16_t *text, size_t length, TextFormat format, std::vector<MisspelledRange> *ranges);
+  virtual void CheckSpelling(const char *text, size_t length, TextEncoding encoding, TextFormat format, std::vector<MisspelledRange> *ranges);
+
+  // Returns the corrections for the word, as GetCorrectionsForMisspelling of
+  // the implementation does.
+  virtual std::vector<std::string> GetCorrectionsForMisspelling(const std::string& word, const SuggestionOptions& options);
+
+  // Sets misspelled[i] to 1 if the i-th of the words in bytes is misspelled
+  // and to 0 otherwise. Unless overridden, each word is given to IsMisspelled
+  // of the implementation.
+  virtual void IsMisspelled(const char *bytes, const WordRange *words, size_t count, uint8_t *misspelled);
+
 private:
   SpellcheckerImplementation *impl;
 };
@@ -40,31 +121,146 @@ private:
 class SpellcheckerImplementation {
 public:
   virtual bool SetDictionary(const std::string& language, const std::string& path) = 0;
+
+  // Sets several dictionaries in the same directory, a word being spelled
+  // correctly if any of them has it. Returns false if any of them cannot be
+  // set. Unless overridden, only one dictionary can be set.
+  virtual bool SetDictionaries(const std::vector<std::string>& languages, const std::string& path)
+  {
+    return languages.size() == 1 && SetDictionary(languages[0], path);
+  }
+
+  // Compiles the dictionary into a binary image next to it, which later calls
+  // of SetDictionary map instead of parsing the dictionary. Returns false if
+  // the implementation has no such format or the image cannot be written.
+  virtual bool CompileDictionary(const std::string& language, const std::string& path)
+  {
+    return false;
+  }
+
   virtual std::vector<std::string> GetAvailableDictionaries(const std::string& path) = 0;
 
   // Returns an array containing possible corrections for the word.
   virtual std::vector<std::string> GetCorrectionsForMisspelling(const std::string& word) = 0;
 
+  // Returns the corrections for the word within the limits of the options.
+  // Unless overridden, only their number is limited.
+  virtual std::vector<std::string> GetCorrectionsForMisspelling(const std::string& word, const SuggestionOptions& options)
+  {
+    std::vector<std::string> corrections = GetCorrectionsForMisspelling(word);
+    if (options.maxSuggestions > 0 && corrections.size() > options.maxSuggestions) {
+      corrections.resize(options.maxSuggestions);
+    }
+
+    return corrections;
+  }
+
   // Returns true if the word is misspelled.
   virtual bool IsMisspelled(const std::string& word) = 0;
 
   virtual std::vector<MisspelledRange> CheckSpelling(const uint16_t *text, size_t length) = 0;
 
+  // Checks Latin-1 or UTF-8 text. Unless overridden, the text is converted to
+  // UTF-16 first.
+  virtual std::vector<MisspelledRange> CheckSpelling(const char *text, size_t length, TextEncoding encoding)
+  {
+    std::vector<uint16_t> utf16_text;
+    DecodeTextToUTF16(text, length, encoding, &utf16_text);
+    return CheckSpelling(utf16_text.data(), utf16_text.size());
+  }
+
+  // Checks text in a markup format, skipping its tags, commands and code,
+  // with the ranges in the whole text. Unless overridden, each part of the
+  // text between the markup is checked by itself.
+  virtual std::vector<MisspelledRange> CheckSpelling(const uint16_t *text, size_t length, TextFormat format);
+
+  virtual std::vector<MisspelledRange> CheckSpelling(const char *text, size_t length, TextEncoding encoding, TextFormat format)
+  {
+    std::vector<uint16_t> utf16_text;
+    DecodeTextToUTF16(text, length, encoding, &utf16_text);
+    return CheckSpelling(utf16_text.data(), utf16_text.size(), format);
+  }
+
   // Adds a new word to the dictionary.
   // NB: When using Hunspell, this will not modify the .dic file; custom words must be added each
-  // time the spellchecker is created. Use a custom dictionary file.
+  // time the spellchecker is created, unless kept by SetPersonalDictionary.
   virtual void Add(const std::string& word) = 0;
 
   // Removes a word from the custom dictionary added by Add.
   // NB: When using Hunspell, this will not modify the .dic file; custom words must be added each
-  // time the spellchecker is created. Use a custom dictionary file.
+  // time the spellchecker is created, unless kept by SetPersonalDictionary.
   virtual void Remove(const std::string& word) = 0;
 
+  // Adds or removes many words at once. Unless overridden, each word is given
+  // to Add or Remove.
+  virtual void AddWords(const std::vector<std::string>& words)
+  {
+    for (auto word = words.begin(); word != words.end(); ++word) {
+      Add(*word);
+    }
+  }
+
+  virtual void RemoveWords(const std::vector<std::string>& words)
+  {
+    for (auto word = words.begin(); word != words.end(); ++word) {
+      Remove(*word);
+    }
+  }
+
+  // Keeps the words added and removed from now on in a file of one UTF-8 word
+  // per line, a removed word starting with '*', which is read again whenever
+  // the dictionary is set. An empty path stops keeping them. Returns false if
+  // the implementation keeps the words itself, as the system spellcheckers
+  // do.
+  virtual bool SetPersonalDictionary(const std::string& path)
+  {
+    return false;
+  }
+
+  // Skips the text matching the patterns when checking text, so the words
+  // in it are never looked up. Returns false if the implementation cannot
+  // skip text, as the system spellcheckers cannot.
+  virtual bool SetIgnorePatterns(const IgnorePatternSet& patterns)
+  {
+    return false;
+  }
+
+  // Returns the counters of the cache of words found to be spelled correctly
+  // or not, all 0 if the implementation has none.
+  virtual CacheStats GetVerdictCacheStats()
+  {
+    CacheStats stats = {0, 0, 0};
+    return stats;
+  }
+
+  // Returns the counters of the cache of corrections, all 0 if the
+  // implementation has none.
+  virtual CacheStats GetSuggestionCacheStats()
+  {
+    CacheStats stats = {0, 0, 0};
+    return stats;
+  }
+
   virtual std::unique_ptr<SpellcheckerThreadView> CreateThreadView()
   {
     return std::unique_ptr<SpellcheckerThreadView>(new SpellcheckerThreadView(this));
   }
 
+  // Returns true if several thread views can check at the same time, so long
+  // texts and batches of words can be split between them.
+  virtual bool CanCheckInParallel()
+  {
+    return false;
+  }
+
+  // Returns true if the dictionary can be set on another thread while the
+  // spellchecker is used, which goes on checking with the dictionary set
+  // before until the new one is loaded.
+  virtual bool CanSetDictionaryInBackground()
+  {
+    return false;
+  }
+
   virtual ~SpellcheckerImplementation() {}
 };
 
@@ -78,6 +274,66 @@ inline std::vector<MisspelledRange> SpellcheckerThreadView::CheckSpelling(const
   return impl->CheckSpelling(text, length);
 }
 
+inline void SpellcheckerThreadView::CheckSpelling(const uint16_t *text, size_t length, std::vector<MisspelledRange> *ranges)
+{
+  *ranges = CheckSpelling(text, length);
+}
+
+inline void SpellcheckerThreadView::CheckSpelling(const char *text, size_t length, TextEncoding encoding, std::vector<MisspelledRange> *ranges)
+{
+  *ranges = impl->CheckSpelling(text, length, encoding);
+}
+
+inline void SpellcheckerThreadView::CheckSpelling(const uint16_t *text, size_t length, TextFormat format, std::vector<MisspelledRange> *ranges)
+{
+  *ranges = impl->CheckSpelling(text, length, format);
+}
+
+inline void SpellcheckerThreadView::CheckSpelling(const char *text, size_t length, TextEncoding encoding, TextFormat format, std::vector<MisspelledRange> *ranges)
+{
+  *ranges = impl->CheckSpelling(text, length, encoding, format);
+}
+
+inline std::vector<std::string> SpellcheckerThreadView::GetCorrectionsForMisspelling(const std::string& word, const SuggestionOptions& options)
+{
+  return impl->GetCorrectionsForMisspelling(word, options);
+}
+
+inline void SpellcheckerThreadView::IsMisspelled(const char *bytes, const WordRange *words, size_t count, uint8_t *misspelled)
+{
+  for (size_t i = 0; i < count; i++) {
+    misspelled[i] = impl->IsMisspelled(std::string(bytes + words[i].start, words[i].end - words[i].start)) ? 1 : 0;
+  }
+}
+
+inline std::vector<MisspelledRange> SpellcheckerImplementation::CheckSpelling(const uint16_t *text, size_t length, TextFormat format)
+{
+  if (format == PLAIN_TEXT_FORMAT) {
+    return CheckSpelling(text, length);
+  }
+
+  std::vector<MisspelledRange> result;
+  MarkupScanner scanner(format);
+  TextSpan span;
+
+  size_t position = 0;
+  while (scanner.NextSpan(text, length, &position, &span)) {
+    std::vector<MisspelledRange> ranges = CheckSpelling(text + span.start, span.end - span.start);
+
+    for (auto iter = ranges.begin(); iter != ranges.end(); ++iter) {
+      MisspelledRange range;
+      range.start = span.start + iter->start;
+      range.end = span.start + iter->end;
+
+      if (!span.IsCut(range.start, range.end)) {
+        result.push_back(range);
+      }
+    }
+  }
+
+  return result;
+}
+
 }  // namespace spellchecker
 
 #endif  // SRC_SPELLCHECKER_H_
@@ -1,82 +1,525 @@
+#include <climits>
 #include <cstdio>
-#include <cwctype>
-#include <clocale>
+#include <cstdlib>
+#include <cstring>
 #include <algorithm>
+#include <chrono>
 #include "../vendor/hunspell/src/hunspell/hunspell.hxx"
 #include "spellchecker_hunspell.h"
 #include "buffers.h"
+#include "lock.h"
+#include "mapped_file.h"
 
 namespace spellchecker {
 
-HunspellSpellchecker::HunspellSpellchecker() : hunspell(NULL), transcoder(NewUTF16ToUTF8Transcoder()), toDictionaryTranscoder(NULL), fromDictionaryTranscoder(NULL) { }
+namespace {
 
-HunspellSpellchecker::~HunspellSpellchecker() {
-  if (hunspell) {
-    delete hunspell;
+std::string GetDictionaryBasePath(const std::string& language, const std::string& dirname) {
+  // NB: Hunspell uses underscore to separate language and locale, and Win8 uses
+  // dash - if they use the wrong one, just silently replace it for them
+  std::string lang = language;
+  std::replace(lang.begin(), lang.end(), '-', '_');
+
+  return dirname + "/" + lang;
+}
+
+// Loads the dictionary of a language, or returns false if it does not
+// exist.
+bool LoadLanguage(const std::string& name, const std::string& dirname, HunspellLanguage *language) {
+  std::string basepath = GetDictionaryBasePath(name, dirname);
+  std::string affixpath = basepath + ".aff";
+  std::string dpath = basepath + ".dic";
+
+  // TODO: This code is almost certainly jacked on Win32 for non-ASCII paths
+  FILE* handle = fopen(dpath.c_str(), "r");
+  if (!handle) {
+    return false;
   }
+  fclose(handle);
 
-  if (transcoder) {
-    FreeTranscoder(transcoder);
+  // Create the hunspell object with our dictionary. The word list is shared
+  // with the other spellcheckers using it, the words we add or remove are not.
+  language->dictionary = AcquireHunspellDictionary(basepath);
+  language->hunspell = new Hunspell(affixpath.c_str(), GetHunspellDictionaryTable(language->dictionary));
+  language->forms = GetHunspellDictionaryForms(language->dictionary);
+  language->encoding = language->hunspell->get_dic_encoding();
+  return true;
+}
+
+void FreeLanguages(std::vector<HunspellLanguage> *languages) {
+  for (auto language = languages->begin(); language != languages->end(); ++language) {
+    delete language->hunspell;
+    ReleaseHunspellDictionary(language->dictionary);
   }
 
-  if (toDictionaryTranscoder) {
-    FreeTranscoder(toDictionaryTranscoder);
+  languages->clear();
+}
+
+// Makes the transcoders of a thread follow the encodings of the
+// dictionaries, which may have been changed since they were last used.
+// Called with the lock of the spellchecker held.
+void UpdateDictionaryTranscoders(const std::vector<HunspellLanguage>& languages, DictionaryTranscoders *transcoders) {
+  for (size_t i = 0; i < transcoders->encodings.size(); ++i) {
+    if (i < languages.size() && transcoders->encodings[i] == languages[i].encoding) {
+      continue;
+    }
+
+    if (transcoders->toDictionary[i]) {
+      FreeTranscoder(transcoders->toDictionary[i]);
+      transcoders->toDictionary[i] = NULL;
+    }
+
+    if (transcoders->fromDictionary[i]) {
+      FreeTranscoder(transcoders->fromDictionary[i]);
+      transcoders->fromDictionary[i] = NULL;
+    }
+
+    transcoders->encodings[i].clear();
   }
 
-  if (fromDictionaryTranscoder) {
-    FreeTranscoder(fromDictionaryTranscoder);
+  transcoders->encodings.resize(languages.size());
+  transcoders->toDictionary.resize(languages.size(), NULL);
+  transcoders->fromDictionary.resize(languages.size(), NULL);
+
+  for (size_t i = 0; i < languages.size(); ++i) {
+    const std::string& encoding = languages[i].encoding;
+    if (transcoders->encodings[i] == encoding) {
+      continue;
+    }
+
+    // Hunspell has two modes: in UTF-8 mode, everything is treated as a
+    // UTF-8 string which is what we have. Otherwise, it needs the specific
+    // encoding of the file.
+    transcoders->encodings[i] = encoding;
+    if (encoding.compare("UTF-8") != 0) {
+      transcoders->toDictionary[i] = NewTranscoder8to8("UTF8", encoding.c_str());
+      transcoders->fromDictionary[i] = NewTranscoder8to8(encoding.c_str(), "UTF8");
+    }
   }
 }
 
-bool HunspellSpellchecker::SetDictionary(const std::string& language, const std::string& dirname) {
-  if (hunspell) {
-    delete hunspell;
-    hunspell = NULL;
+void FreeDictionaryTranscoders(DictionaryTranscoders *transcoders) {
+  UpdateDictionaryTranscoders(std::vector<HunspellLanguage>(), transcoders);
+}
+
+// Returns true if a UTF-8 word is misspelled in every dictionary. The
+// dictionaries are asked in order until one has the word, and only when
+// neither their surface forms nor the cache know. A word that cannot be
+// transcoded into the encoding of a dictionary is taken as spelled
+// correctly.
+bool IsWordMisspelled(const std::vector<HunspellLanguage>& languages, VerdictCache *verdicts, const DictionaryTranscoders& transcoders, const char *utf8_word, size_t utf8_length) {
+  for (auto language = languages.begin(); language != languages.end(); ++language) {
+    if (language->forms && language->forms->Contains(utf8_word, utf8_length)) {
+      return false;
+    }
   }
 
-  // NB: Hunspell uses underscore to separate language and locale, and Win8 uses
-  // dash - if they use the wrong one, just silently replace it for them
-  std::string lang = language;
-  std::replace(lang.begin(), lang.end(), '-', '_');
+  bool misspelled;
+  if (verdicts->Find(utf8_word, utf8_length, &misspelled)) {
+    return misspelled;
+  }
 
-  std::string affixpath = dirname + "/" + lang + ".aff";
-  std::string dpath = dirname + "/" + lang + ".dic";
+  misspelled = !languages.empty();
+  for (size_t i = 0; misspelled && i < languages.size(); ++i) {
+    // Convert the word into a dictionary-specific encoding.
+    char dict_buffer[MAX_TRANSCODE_BUFFER];
+    misspelled = Transcode8to8(transcoders.toDictionary[i], dict_buffer, sizeof(dict_buffer) - 1, utf8_word, utf8_length) &&
+      languages[i].hunspell->spell(dict_buffer) == 0;
+  }
 
-  // TODO: This code is almost certainly jacked on Win32 for non-ASCII paths
-  FILE* handle = fopen(dpath.c_str(), "r");
-  if (!handle) {
-    return false;
+  verdicts->Insert(utf8_word, utf8_length, misspelled);
+  return misspelled;
+}
+
+// Finds the matches of the ignored patterns as the words of a text go by,
+// so the text is only searched for them once.
+class IgnoredMatches {
+public:
+  IgnoredMatches(const IgnorePatternSet& patterns, bool utf8)
+    : patterns(patterns), utf8(utf8), more(!patterns.IsEmpty()), position(0), start(0), end(0)
+  {
+    //
   }
-  fclose(handle);
 
-  // Create the hunspell object with our dictionary.
-  hunspell = new Hunspell(affixpath.c_str(), dpath.c_str());
+  // Returns true if a word overlaps a match. The words must come in order.
+  template <typename Unit>
+  bool Overlaps(const Unit *text, size_t length, size_t word_start, size_t word_end)
+  {
+    while (more && end <= word_start) {
+      more = NextMatch(text, length);
+    }
 
-  // Once we have the dictionary, then we check to see if we need
-  // an internal conversion. This is needed because Hunspell has
-  // two modes: in UTF-8 mode, everything is treated as a UTF-8
-  // string which is what we have. Otherwise, it needs the specific
-  // encoding of the file.
-  std::string encoding = hunspell->get_dic_encoding();
-  bool isUTF8 = encoding.compare("UTF-8") == 0;
+    return more && start < word_end;
+  }
 
-  if (toDictionaryTranscoder) {
-    FreeTranscoder(toDictionaryTranscoder);
-    toDictionaryTranscoder = NULL;
+private:
+  bool NextMatch(const uint16_t *text, size_t length)
+  {
+    return patterns.NextMatch(text, length, &position, &start, &end);
   }
 
-  if (fromDictionaryTranscoder) {
-    FreeTranscoder(fromDictionaryTranscoder);
-    fromDictionaryTranscoder = NULL;
+  bool NextMatch(const char *text, size_t length)
+  {
+    return patterns.NextMatch(text, length, utf8, &position, &start, &end);
   }
 
-  if (!isUTF8) {
-    toDictionaryTranscoder = NewTranscoder8to8("UTF8", encoding.c_str());
-    fromDictionaryTranscoder = NewTranscoder8to8(encoding.c_str(), "UTF8");
+  const IgnorePatternSet& patterns;
+  bool utf8;
+  bool more;
+
+  // Where to look for the next match, and the last one found.
+  size_t position;
+  size_t start;
+  size_t end;
+};
+
+// Checks the words of a text with the transcoders of the calling thread, and
+// appends the ranges of the misspelled ones. The words are transcoded in
+// buffers on the stack, so nothing is allocated unless the ranges grow.
+// Only the parts of the text between its markup, if any, are segmented, the
+// identifiers of source code are split into their words, and the words in
+// ignored text are passed over.
+void DoCheckSpelling(const std::vector<HunspellLanguage>& languages, VerdictCache *verdicts, const WordSegmenter& segmenter, const IgnorePatternSet& ignorePatterns, const Transcoder *transcoder, const DictionaryTranscoders& dictionaryTranscoders, const uint16_t *utf16_text, size_t utf16_length, TextFormat format, std::vector<MisspelledRange> *ranges) {
+  if (languages.empty() || !transcoder) {
+    return;
   }
 
-  // Return that we successfully created the components.
-  return true;
+  // Leave room for the terminating character the transcoders add.
+  char utf8_buffer[MAX_UTF16_TO_UTF8_BUFFER + 1];
+
+  MarkupScanner scanner(format);
+  TextSpan span;
+  bool splitIdentifiers = format == SOURCE_CODE_FORMAT;
+  IgnoredMatches ignored(ignorePatterns, false);
+
+  size_t span_position = 0;
+  while (scanner.NextSpan(utf16_text, utf16_length, &span_position, &span)) {
+    size_t position = span.start, word_start, word_end;
+    while (segmenter.NextWord(utf16_text, span.end, &position, &word_start, &word_end, splitIdentifiers)) {
+      if (span.IsCut(word_start, word_end) || ignored.Overlaps(utf16_text, utf16_length, word_start, word_end)) {
+        continue;
+      }
+
+      bool converted = TranscodeUTF16ToUTF8(transcoder, utf8_buffer, MAX_UTF16_TO_UTF8_BUFFER, utf16_text + word_start, word_end - word_start);
+
+      if (converted && IsWordMisspelled(languages, verdicts, dictionaryTranscoders, utf8_buffer, strlen(utf8_buffer))) {
+        MisspelledRange range;
+        range.start = word_start;
+        range.end = word_end;
+        ranges->push_back(range);
+      }
+    }
+  }
+}
+
+// Checks the words of Latin-1 or UTF-8 text the same way. UTF-8 words are
+// transcoded straight from the text, and their bytes are only counted in
+// UTF-16 units for the ranges of the misspelled ones.
+void DoCheckSpelling(const std::vector<HunspellLanguage>& languages, VerdictCache *verdicts, const WordSegmenter& segmenter, const IgnorePatternSet& ignorePatterns, const DictionaryTranscoders& dictionaryTranscoders, const char *text, size_t length, TextEncoding encoding, TextFormat format, std::vector<MisspelledRange> *ranges) {
+  if (languages.empty()) {
+    return;
+  }
+
+  char utf8_buffer[MAX_UTF16_TO_UTF8_BUFFER + 1];
+
+  // The byte up to which the text has been counted, and its UTF-16 length.
+  size_t counted = 0, utf16_counted = 0;
+
+  MarkupScanner scanner(format);
+  TextSpan span;
+  bool splitIdentifiers = format == SOURCE_CODE_FORMAT;
+  IgnoredMatches ignored(ignorePatterns, encoding == UTF8_TEXT);
+
+  size_t span_position = 0;
+  while (scanner.NextSpan(text, length, &span_position, &span)) {
+    size_t position = span.start, word_start, word_end;
+    while (encoding == UTF8_TEXT ?
+        segmenter.NextUTF8Word(text, span.end, &position, &word_start, &word_end, splitIdentifiers) :
+        segmenter.NextLatin1Word(text, span.end, &position, &word_start, &word_end, splitIdentifiers)) {
+      if (span.IsCut(word_start, word_end) || ignored.Overlaps(text, length, word_start, word_end)) {
+        continue;
+      }
+
+      const char *utf8_word = text + word_start;
+      size_t utf8_length = word_end - word_start;
+      bool converted;
+
+      if (encoding == UTF8_TEXT) {
+        converted = utf8_length <= MAX_UTF16_TO_UTF8_BUFFER;
+      } else {
+        converted = EncodeLatin1ToUTF8(utf8_buffer, MAX_UTF16_TO_UTF8_BUFFER, utf8_word, utf8_length);
+        utf8_word = utf8_buffer;
+        utf8_length = strlen(utf8_buffer);
+      }
+
+      if (converted && IsWordMisspelled(languages, verdicts, dictionaryTranscoders, utf8_word, utf8_length)) {
+        MisspelledRange range;
+        range.start = word_start;
+        range.end = word_end;
+
+        if (encoding == UTF8_TEXT) {
+          utf16_counted += CountUTF16Units(text + counted, word_start - counted);
+          range.start = utf16_counted;
+          utf16_counted += CountUTF16Units(text + word_start, word_end - word_start);
+          range.end = utf16_counted;
+          counted = word_end;
+        }
+
+        ranges->push_back(range);
+      }
+    }
+  }
+}
+
+// Returns the corrections for a UTF-8 word from each dictionary in turn,
+// with the transcoders of the calling thread, asking the dictionaries only
+// when the cache does not have them.
+std::vector<std::string> DoGetCorrectionsForMisspelling(const std::vector<HunspellLanguage>& languages, SuggestionCache *suggestions, const DictionaryTranscoders& transcoders, const std::string& word, const SuggestionOptions& options) {
+  std::vector<std::string> corrections;
+
+  // If the word is too long, then don't do anything.
+  if (word.length() > MAX_UTF8_BUFFER || languages.empty()) {
+    return corrections;
+  }
+
+  // Skipping strategies finds other corrections, so they are cached apart.
+  // All those found without a limit are cached, and a limited number of them
+  // is taken from there.
+  std::string key = word;
+  if (options.skip) {
+    key.push_back('\0');
+    key += std::to_string(options.skip);
+  }
+
+  if (suggestions->Find(key, &corrections)) {
+    if (options.maxSuggestions > 0 && corrections.size() > options.maxSuggestions) {
+      corrections.resize(options.maxSuggestions);
+    }
+
+    return corrections;
+  }
+
+  // The limits are shared by the dictionaries, so the later ones are only
+  // asked while there is time left and room for more corrections.
+  std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+
+  for (size_t i = 0; i < languages.size(); ++i) {
+    suggestoptions limits;
+    limits.maxsug = 0;
+    limits.timeout = 0;
+    limits.skip = 0;
+
+    if (options.maxSuggestions > 0) {
+      if (corrections.size() >= options.maxSuggestions) {
+        break;
+      }
+
+      limits.maxsug = static_cast<int>(std::min<size_t>(options.maxSuggestions - corrections.size(), INT_MAX));
+    }
+
+    if (options.timeout > 0) {
+      double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+      if (elapsed >= options.timeout) {
+        break;
+      }
+
+      limits.timeout = options.timeout - elapsed;
+    }
+
+    if (options.skip & SKIP_NGRAM_SUGGESTIONS) {
+      limits.skip |= SUGGEST_NO_NGRAM;
+    }
+    if (options.skip & SKIP_PHONETIC_SUGGESTIONS) {
+      limits.skip |= SUGGEST_NO_PHONETIC;
+    }
+    if (options.skip & SKIP_TWO_WORD_SUGGESTIONS) {
+      limits.skip |= SUGGEST_NO_TWOWORDS;
+    }
+    if (options.skip & SKIP_COMPOUND_SUGGESTIONS) {
+      limits.skip |= SUGGEST_NO_COMPOUND;
+    }
+
+    // Convert the buffer into a dictionary-specific encoding.
+    char dict_buffer[MAX_TRANSCODE_BUFFER];
+    if (!Transcode8to8(transcoders.toDictionary[i], dict_buffer, sizeof(dict_buffer) - 1, word.data(), word.size())) {
+      continue;
+    }
+
+    // Get the suggested on the dictionary-encoded word.
+    Hunspell *hunspell = languages[i].hunspell;
+    char** slist;
+    int size = hunspell->suggest(&slist, dict_buffer, &limits);
+
+    corrections.reserve(corrections.size() + size);
+
+    for (int j = 0; j < size; ++j) {
+      // The items in the `slist` are still in dictionary encoding. We need to
+      // convert them back to UTF-8 so Chrome/V8 can play with them properly.
+      bool converted = Transcode8to8(transcoders.fromDictionary[i], dict_buffer, sizeof(dict_buffer) - 1, slist[j], strlen(slist[j]));
+
+      // If we couldn't convert, we need to put the poorly encoded one so
+      // they can see it.
+      std::string correction = converted ? dict_buffer : slist[j];
+
+      // The dictionaries can suggest the same word.
+      if (std::find(corrections.begin(), corrections.end(), correction) == corrections.end()) {
+        corrections.push_back(correction);
+      }
+    }
+
+    hunspell->free_list(&slist, size);
+  }
+
+  if (options.maxSuggestions == 0 && options.timeout <= 0) {
+    suggestions->Insert(key, corrections);
+  }
+
+  return corrections;
+}
+
+}  // namespace
+
+HunspellSpellcheckerThreadView::HunspellSpellcheckerThreadView(HunspellSpellchecker *impl) :
+  SpellcheckerThreadView(impl),
+  impl(impl),
+  transcoder(NewUTF16ToUTF8Transcoder())
+{
+}
+
+HunspellSpellcheckerThreadView::~HunspellSpellcheckerThreadView() {
+  if (transcoder) {
+    FreeTranscoder(transcoder);
+  }
+
+  FreeDictionaryTranscoders(&dictionaryTranscoders);
+}
+
+std::vector<MisspelledRange> HunspellSpellcheckerThreadView::CheckSpelling(const uint16_t *utf16_text, size_t utf16_length) {
+  std::vector<MisspelledRange> result;
+  CheckSpelling(utf16_text, utf16_length, &result);
+  return result;
+}
+
+void HunspellSpellcheckerThreadView::CheckSpelling(const uint16_t *utf16_text, size_t utf16_length, std::vector<MisspelledRange> *ranges) {
+  CheckSpelling(utf16_text, utf16_length, PLAIN_TEXT_FORMAT, ranges);
+}
+
+void HunspellSpellcheckerThreadView::CheckSpelling(const char *text, size_t length, TextEncoding encoding, std::vector<MisspelledRange> *ranges) {
+  CheckSpelling(text, length, encoding, PLAIN_TEXT_FORMAT, ranges);
+}
+
+void HunspellSpellcheckerThreadView::CheckSpelling(const uint16_t *utf16_text, size_t utf16_length, TextFormat format, std::vector<MisspelledRange> *ranges) {
+  ReadLock readLock(impl->lock);
+  ranges->clear();
+
+  UpdateDictionaryTranscoders(impl->languages, &dictionaryTranscoders);
+  DoCheckSpelling(impl->languages, &impl->verdicts, impl->segmenter, impl->ignorePatterns, transcoder, dictionaryTranscoders, utf16_text, utf16_length, format, ranges);
+}
+
+void HunspellSpellcheckerThreadView::CheckSpelling(const char *text, size_t length, TextEncoding encoding, TextFormat format, std::vector<MisspelledRange> *ranges) {
+  ReadLock readLock(impl->lock);
+  ranges->clear();
+
+  UpdateDictionaryTranscoders(impl->languages, &dictionaryTranscoders);
+  DoCheckSpelling(impl->languages, &impl->verdicts, impl->segmenter, impl->ignorePatterns, dictionaryTranscoders, text, length, encoding, format, ranges);
+}
+
+std::vector<std::string> HunspellSpellcheckerThreadView::GetCorrectionsForMisspelling(const std::string& word, const SuggestionOptions& options) {
+  ReadLock readLock(impl->lock);
+
+  UpdateDictionaryTranscoders(impl->languages, &dictionaryTranscoders);
+  return DoGetCorrectionsForMisspelling(impl->languages, &impl->suggestions, dictionaryTranscoders, word, options);
+}
+
+void HunspellSpellcheckerThreadView::IsMisspelled(const char *bytes, const WordRange *words, size_t count, uint8_t *misspelled) {
+  ReadLock readLock(impl->lock);
+
+  UpdateDictionaryTranscoders(impl->languages, &dictionaryTranscoders);
+  for (size_t i = 0; i < count; i++) {
+    const char *word = bytes + words[i].start;
+    size_t length = words[i].end - words[i].start;
+
+    // Words too long to check are taken as spelled correctly, as by
+    // IsMisspelled of the spellchecker.
+    misspelled[i] = !impl->languages.empty() && length <= MAX_UTF8_BUFFER &&
+      IsWordMisspelled(impl->languages, &impl->verdicts, dictionaryTranscoders, word, length) ? 1 : 0;
+  }
+}
+
+HunspellSpellchecker::HunspellSpellchecker() : transcoder(NewUTF16ToUTF8Transcoder()) {
+  uv_rwlock_init(&lock);
+}
+
+HunspellSpellchecker::~HunspellSpellchecker() {
+  uv_rwlock_destroy(&lock);
+
+  FreeLanguages(&languages);
+
+  if (transcoder) {
+    FreeTranscoder(transcoder);
+  }
+
+  FreeDictionaryTranscoders(&dictionaryTranscoders);
+}
+
+bool HunspellSpellchecker::SetDictionary(const std::string& language, const std::string& dirname) {
+  return SetDictionaries(std::vector<std::string>(1, language), dirname);
+}
+
+bool HunspellSpellchecker::SetDictionaries(const std::vector<std::string>& languageNames, const std::string& dirname) {
+  // The dictionaries are loaded before the lock is taken, so the ones set
+  // before are checked with until they are swapped for the new ones. Those
+  // that are found are used even if others are not.
+  std::vector<HunspellLanguage> loaded;
+  bool result = true;
+
+  for (auto name = languageNames.begin(); name != languageNames.end(); ++name) {
+    HunspellLanguage language;
+    if (LoadLanguage(*name, dirname, &language)) {
+      loaded.push_back(language);
+    } else {
+      result = false;
+    }
+  }
+
+  {
+    WriteLock writeLock(lock);
+
+    verdicts.Clear();
+    suggestions.Clear();
+    languages.swap(loaded);
+
+    // Once we have the dictionaries, then we check to see if we need
+    // internal conversions.
+    UpdateDictionaryTranscoders(languages, &dictionaryTranscoders);
+
+    // Words also run across the WORDCHARS of each dictionary, such as hyphens.
+    std::string wordchars;
+    for (size_t i = 0; i < languages.size(); ++i) {
+      const char *chars = languages[i].hunspell->get_wordchars();
+      char wordchars_buffer[MAX_TRANSCODE_BUFFER];
+
+      if (chars && strlen(chars) <= MAX_UTF8_BUFFER &&
+          Transcode8to8(dictionaryTranscoders.fromDictionary[i], wordchars_buffer, sizeof(wordchars_buffer) - 1, chars, strlen(chars))) {
+        wordchars += wordchars_buffer;
+      }
+    }
+
+    segmenter.SetWordCharacters(wordchars.c_str());
+
+    // The words kept in the personal dictionary go on top of the dictionaries.
+    LoadPersonalDictionary();
+  }
+
+  // Nothing can be checking with the dictionaries set before anymore.
+  FreeLanguages(&loaded);
+
+  // Return whether we successfully created the components of all of them.
+  return result;
+}
+
+bool HunspellSpellchecker::CompileDictionary(const std::string& language, const std::string& dirname) {
+  return CompileHunspellDictionary(GetDictionaryBasePath(language, dirname));
 }
 
 std::vector<std::string> HunspellSpellchecker::GetAvailableDictionaries(const std::string& path) {
@@ -84,7 +527,9 @@ std::vector<std::string> HunspellSpellchecker::GetAvailableDictionaries(const st
 }
 
 bool HunspellSpellchecker::IsMisspelled(const std::string& word) {
-  if (!hunspell) {
+  ReadLock readLock(lock);
+
+  if (languages.empty()) {
     return false;
   }
 
@@ -93,140 +538,239 @@ bool HunspellSpellchecker::IsMisspelled(const std::string& word) {
     return false;
   }
 
-  // If we have a dictionary transcoder, then we need to transcode
-  // the input into the encoding the dictionary requires.
-  std::vector<char> dict_buffer(MAX_TRANSCODE_BUFFER);
-  bool converted = Transcode8to8(toDictionaryTranscoder, dict_buffer.data(), dict_buffer.size(), word.data(), word.size());
+  return IsWordMisspelled(languages, &verdicts, dictionaryTranscoders, word.data(), word.size());
+}
 
-  if (!converted) {
-    return false;
-  }
+std::vector<MisspelledRange> HunspellSpellchecker::CheckSpelling(const uint16_t *utf16_text, size_t utf16_length) {
+  return CheckSpelling(utf16_text, utf16_length, PLAIN_TEXT_FORMAT);
+}
 
-  // Process the call on the transcoded data.
-  return hunspell->spell(dict_buffer.data()) == 0;
+std::vector<MisspelledRange> HunspellSpellchecker::CheckSpelling(const char *text, size_t length, TextEncoding encoding) {
+  return CheckSpelling(text, length, encoding, PLAIN_TEXT_FORMAT);
 }
 
-std::vector<MisspelledRange> HunspellSpellchecker::CheckSpelling(const uint16_t *utf16_text, size_t utf16_length) {
+std::vector<MisspelledRange> HunspellSpellchecker::CheckSpelling(const uint16_t *utf16_text, size_t utf16_length, TextFormat format) {
+  ReadLock readLock(lock);
   std::vector<MisspelledRange> result;
 
-  if (!hunspell || !transcoder) {
-    return result;
-  }
+  DoCheckSpelling(languages, &verdicts, segmenter, ignorePatterns, transcoder, dictionaryTranscoders, utf16_text, utf16_length, format, &result);
+  return result;
+}
 
-  std::vector<char> utf8_buffer(MAX_UTF16_TO_UTF8_BUFFER);
+std::vector<MisspelledRange> HunspellSpellchecker::CheckSpelling(const char *text, size_t length, TextEncoding encoding, TextFormat format) {
+  ReadLock readLock(lock);
+  std::vector<MisspelledRange> result;
 
-  enum {
-    unknown,
-    in_separator,
-    in_word,
-  } state = in_separator;
+  DoCheckSpelling(languages, &verdicts, segmenter, ignorePatterns, dictionaryTranscoders, text, length, encoding, format, &result);
+  return result;
+}
 
-  // Because all of the strings are UTF-8 because we got them from Chrome that
-  // way, we need to make sure our iswalpha works on UTF-8 strings. We picked a
-  // generic locale because we don't pass the locale in. Sadly, "C.utf8" doesn't
-  // work so we assume that US English is available everywhere.
-  setlocale(LC_CTYPE, "en_US.UTF-8");
+void HunspellSpellchecker::Add(const std::string& word) {
+  ChangeWords(std::vector<std::string>(1, word), false);
+}
 
-  // Go through the UTF-16 characters and look for breaks.
-  for (size_t word_start = 0, i = 0; i < utf16_length; i++) {
-    uint16_t c = utf16_text[i];
+void HunspellSpellchecker::Remove(const std::string& word) {
+  ChangeWords(std::vector<std::string>(1, word), true);
+}
 
-    switch (state) {
-      case unknown:
-        if (iswpunct(c) || iswspace(c)) {
-          state = in_separator;
-        }
-        break;
+void HunspellSpellchecker::AddWords(const std::vector<std::string>& words) {
+  ChangeWords(words, false);
+}
 
-      case in_separator:
-        if (iswalpha(c)) {
-          word_start = i;
-          state = in_word;
-        } else if (!iswpunct(c) && !iswspace(c)) {
-          state = unknown;
-        }
-        break;
+void HunspellSpellchecker::RemoveWords(const std::vector<std::string>& words) {
+  ChangeWords(words, true);
+}
 
-      case in_word:
-        if (c == '\'' && iswalpha(utf16_text[i + 1])) {
-          i++;
-        } else if (c == 0 || iswpunct(c) || iswspace(c)) {
-          state = in_separator;
-          bool converted = TranscodeUTF16ToUTF8(transcoder, (char *)utf8_buffer.data(), utf8_buffer.size(), utf16_text + word_start, i - word_start);
-
-          if (converted) {
-            // Convert the buffer into a dictionary-specific encoding.
-            std::vector<char> dict_buffer(MAX_TRANSCODE_BUFFER);
-            converted = Transcode8to8(toDictionaryTranscoder, dict_buffer.data(), dict_buffer.size(), utf8_buffer.data(), utf8_buffer.size());
-
-            if (converted) {
-              // Pass in the dictionary-encoded text for spelling.
-              if (hunspell->spell(dict_buffer.data()) == 0) {
-                MisspelledRange range;
-                range.start = word_start;
-                range.end = i;
-                result.push_back(range);
-              }
-            }
-          }
-        } else if (!iswalpha(c)) {
-          state = unknown;
-        }
-        break;
+bool HunspellSpellchecker::SetPersonalDictionary(const std::string& path) {
+  WriteLock writeLock(lock);
+  verdicts.Clear();
+  suggestions.Clear();
+
+  personalDictionaryPath = path;
+  LoadPersonalDictionary();
+  return true;
+}
+
+bool HunspellSpellchecker::SetIgnorePatterns(const IgnorePatternSet& patterns) {
+  WriteLock writeLock(lock);
+  ignorePatterns = patterns;
+  return true;
+}
+
+void HunspellSpellchecker::ChangeWords(const std::vector<std::string>& words, bool remove) {
+  WriteLock writeLock(lock);
+  verdicts.Clear();
+  suggestions.Clear();
+
+  // A removed word may be one of the surface forms, which are not checked
+  // against the words of this spellchecker.
+  if (remove) {
+    for (auto language = languages.begin(); language != languages.end(); ++language) {
+      language->forms = NULL;
     }
   }
 
-  return result;
-}
+  // Removing a word of a dictionary adds a forbidden copy of it, so room is
+  // made for the words either way.
+  size_t bytes = 0;
+  for (auto word = words.begin(); word != words.end(); ++word) {
+    bytes += word->size() + 1;
+  }
 
-void HunspellSpellchecker::Add(const std::string& word) {
-  if (hunspell) {
-    hunspell->add(word.c_str());
+  for (auto language = languages.begin(); language != languages.end(); ++language) {
+    language->hunspell->reserve(static_cast<int>(std::min<size_t>(words.size(), INT_MAX)), bytes);
   }
+
+  for (auto word = words.begin(); word != words.end(); ++word) {
+    ChangeWord(word->data(), word->size(), remove);
+  }
+
+  AppendToPersonalDictionary(words, remove);
 }
 
-void HunspellSpellchecker::Remove(const std::string& word) {
-  if (hunspell) {
-    hunspell->remove(word.c_str());
+void HunspellSpellchecker::ChangeWord(const char *word, size_t length, bool remove) {
+  if (length > MAX_UTF8_BUFFER) {
+    return;
+  }
+
+  // The words are looked up in the encoding of each dictionary, so they are
+  // added in it too. A word removed from one dictionary would still be found
+  // in the others, so it is removed from all of them.
+  for (size_t i = 0; i < languages.size(); ++i) {
+    char dict_buffer[MAX_TRANSCODE_BUFFER];
+    if (!Transcode8to8(dictionaryTranscoders.toDictionary[i], dict_buffer, sizeof(dict_buffer) - 1, word, length)) {
+      continue;
+    }
+
+    if (remove) {
+      languages[i].hunspell->remove(dict_buffer);
+    } else {
+      languages[i].hunspell->add(dict_buffer);
+    }
   }
 }
 
-std::vector<std::string> HunspellSpellchecker::GetCorrectionsForMisspelling(const std::string& word) {
-  std::vector<std::string> corrections;
+void HunspellSpellchecker::LoadPersonalDictionary() {
+  if (languages.empty() || personalDictionaryPath.empty()) {
+    return;
+  }
 
-  if (hunspell) {
-    // Convert the buffer into a dictionary-specific encoding.
-    std::vector<char> dict_buffer(MAX_TRANSCODE_BUFFER);
-    bool converted = Transcode8to8(toDictionaryTranscoder, dict_buffer.data(), dict_buffer.size(), word.data(), word.size());
-
-    if (converted) {
-      // Get the suggested on the dictionary-encoded word.
-      char** slist;
-      int size = hunspell->suggest(&slist, dict_buffer.data());
-
-      corrections.reserve(size);
-
-      for (int i = 0; i < size; ++i) {
-        // The items in the `slist` are still in dictionary encoding. We need to
-        // convert them back to UTF-8 so Chrome/V8 can play with them properly.
-        std::string word = slist[i];
-        bool converted = Transcode8to8(fromDictionaryTranscoder, dict_buffer.data(), dict_buffer.size(), word.data(), word.size());
-
-        if (converted) {
-          // Put this one back in encoded format.
-          corrections.push_back(dict_buffer.data());
-        } else {
-          // If we couldn't convert, we need to put the poorly encoded one so
-          // they can see it.
-          corrections.push_back(slist[i]);
+  // A missing or empty file has no words yet.
+  MappedFile *file = NewMappedFile(personalDictionaryPath);
+  if (!file) {
+    return;
+  }
+
+  const char *data = GetMappedData(file);
+  size_t size = GetMappedSize(file);
+
+  size_t lines = 1;
+  for (const char *newline = data; (newline = static_cast<const char *>(memchr(newline, '\n', data + size - newline))); newline++) {
+    lines++;
+  }
+
+  for (auto language = languages.begin(); language != languages.end(); ++language) {
+    language->hunspell->reserve(static_cast<int>(std::min<size_t>(lines, INT_MAX)), size);
+  }
+
+  for (size_t start = 0; start < size;) {
+    const char *newline = static_cast<const char *>(memchr(data + start, '\n', size - start));
+    size_t end = newline ? newline - data : size;
+    size_t word_end = end;
+
+    if (word_end > start && data[word_end - 1] == '\r') {
+      word_end--;
+    }
+
+    bool removed = word_end > start && data[start] == '*';
+    size_t word_start = removed ? start + 1 : start;
+
+    if (word_end > word_start) {
+      if (removed) {
+        for (auto language = languages.begin(); language != languages.end(); ++language) {
+          language->forms = NULL;
         }
       }
 
-      hunspell->free_list(&slist, size);
+      ChangeWord(data + word_start, word_end - word_start, removed);
     }
+
+    start = end + 1;
   }
 
-  return corrections;
+  FreeMappedFile(file);
+}
+
+void HunspellSpellchecker::AppendToPersonalDictionary(const std::vector<std::string>& words, bool removed) {
+  if (personalDictionaryPath.empty()) {
+    return;
+  }
+
+  std::string lines;
+  for (auto word = words.begin(); word != words.end(); ++word) {
+    // Words that would not be read back as themselves are only kept until
+    // the dictionary is set again.
+    if (word->empty() || (*word)[0] == '*' || word->find_first_of("\r\n") != std::string::npos) {
+      continue;
+    }
+
+    if (removed) {
+      lines.push_back('*');
+    }
+
+    lines += *word;
+    lines.push_back('\n');
+  }
+
+  if (lines.empty()) {
+    return;
+  }
+
+  // TODO: This code is almost certainly jacked on Win32 for non-ASCII paths
+  FILE *handle = fopen(personalDictionaryPath.c_str(), "a+b");
+  if (!handle) {
+    return;
+  }
+
+  // Start on a line of its own if the file was edited to end without one.
+  if (fseek(handle, -1, SEEK_END) == 0 && fgetc(handle) != '\n') {
+    lines.insert(lines.begin(), '\n');
+  }
+
+  fseek(handle, 0, SEEK_END);
+  fwrite(lines.data(), 1, lines.size(), handle);
+  fclose(handle);
+}
+
+std::vector<std::string> HunspellSpellchecker::GetCorrectionsForMisspelling(const std::string& word) {
+  return GetCorrectionsForMisspelling(word, SuggestionOptions());
+}
+
+std::vector<std::string> HunspellSpellchecker::GetCorrectionsForMisspelling(const std::string& word, const SuggestionOptions& options) {
+  ReadLock readLock(lock);
+  return DoGetCorrectionsForMisspelling(languages, &suggestions, dictionaryTranscoders, word, options);
+}
+
+std::unique_ptr<SpellcheckerThreadView> HunspellSpellchecker::CreateThreadView() {
+  return std::unique_ptr<SpellcheckerThreadView>(new HunspellSpellcheckerThreadView(this));
+}
+
+CacheStats HunspellSpellchecker::GetVerdictCacheStats() {
+  ReadLock readLock(lock);
+  return verdicts.GetStats();
+}
+
+CacheStats HunspellSpellchecker::GetSuggestionCacheStats() {
+  ReadLock readLock(lock);
+  return suggestions.GetStats();
+}
+
+bool HunspellSpellchecker::CanCheckInParallel() {
+  return true;
+}
+
+bool HunspellSpellchecker::CanSetDictionaryInBackground() {
+  return true;
 }
 
 }  // namespace spellchecker
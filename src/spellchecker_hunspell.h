@@ -1,31 +1,126 @@
 #ifndef SRC_SPELLCHECKER_HUNSPELL_H_
 #define SRC_SPELLCHECKER_HUNSPELL_H_
 
+#include <uv.h>
+
 #include "spellchecker.h"
 #include "transcoder.h"
+#include "hunspell_dictionary.h"
+#include "word_segmenter.h"
+#include "verdict_cache.h"
+#include "suggestion_cache.h"
 
 class Hunspell;
 
 namespace spellchecker {
 
+class HunspellSpellchecker;
+
+// One of the dictionaries of a spellchecker, which are tried in the order
+// they were set.
+struct HunspellLanguage {
+  Hunspell* hunspell;
+  HunspellDictionary* dictionary;
+
+  // The surface forms of the dictionary, known to be spelled correctly until
+  // a word is removed.
+  const SurfaceFormSet *forms;
+  std::string encoding;
+};
+
+// The transcoders of a thread between UTF-8 and the encoding of each
+// dictionary, NULL for the dictionaries in UTF-8.
+struct DictionaryTranscoders {
+  std::vector<std::string> encodings;
+  std::vector<Transcoder *> toDictionary;
+  std::vector<Transcoder *> fromDictionary;
+};
+
+// Checks spelling and finds corrections on another thread, with its own
+// transcoders over the dictionary of the spellchecker.
+class HunspellSpellcheckerThreadView : public SpellcheckerThreadView {
+public:
+  HunspellSpellcheckerThreadView(HunspellSpellchecker *impl);
+  ~HunspellSpellcheckerThreadView() override;
+
+  std::vector<MisspelledRange> CheckSpelling(const uint16_t *text, size_t length) override;
+  void CheckSpelling(const uint16_t *text, size_t length, std::vector<MisspelledRange> *ranges) override;
+  void CheckSpelling(const char *text, size_t length, TextEncoding encoding, std::vector<MisspelledRange> *ranges) override;
+  void CheckSpelling(const uint16_t *text, size_t length, TextFormat format, std::vector<MisspelledRange> *ranges) override;
+  void CheckSpelling(const char *text, size_t length, TextEncoding encoding, TextFormat format, std::vector<MisspelledRange> *ranges) override;
+  std::vector<std::string> GetCorrectionsForMisspelling(const std::string& word, const SuggestionOptions& options) override;
+  void IsMisspelled(const char *bytes, const WordRange *words, size_t count, uint8_t *misspelled) override;
+
+private:
+  HunspellSpellchecker *impl;
+  Transcoder *transcoder;
+  DictionaryTranscoders dictionaryTranscoders;
+};
+
 class HunspellSpellchecker : public SpellcheckerImplementation {
 public:
   HunspellSpellchecker();
   ~HunspellSpellchecker();
 
   bool SetDictionary(const std::string& language, const std::string& path);
+  bool SetDictionaries(const std::vector<std::string>& languages, const std::string& path);
+  bool CompileDictionary(const std::string& language, const std::string& path);
   std::vector<std::string> GetAvailableDictionaries(const std::string& path);
   std::vector<std::string> GetCorrectionsForMisspelling(const std::string& word);
+  std::vector<std::string> GetCorrectionsForMisspelling(const std::string& word, const SuggestionOptions& options);
   bool IsMisspelled(const std::string& word);
   std::vector<MisspelledRange> CheckSpelling(const uint16_t *text, size_t length);
+  std::vector<MisspelledRange> CheckSpelling(const char *text, size_t length, TextEncoding encoding);
+  std::vector<MisspelledRange> CheckSpelling(const uint16_t *text, size_t length, TextFormat format);
+  std::vector<MisspelledRange> CheckSpelling(const char *text, size_t length, TextEncoding encoding, TextFormat format);
   void Add(const std::string& word);
   void Remove(const std::string& word);
+  void AddWords(const std::vector<std::string>& words);
+  void RemoveWords(const std::vector<std::string>& words);
+  bool SetPersonalDictionary(const std::string& path);
+  bool SetIgnorePatterns(const IgnorePatternSet& patterns);
+
+  CacheStats GetVerdictCacheStats();
+  CacheStats GetSuggestionCacheStats();
+
+  std::unique_ptr<SpellcheckerThreadView> CreateThreadView();
+  bool CanCheckInParallel();
+  bool CanSetDictionaryInBackground();
 
 private:
-  Hunspell* hunspell;
+  friend class HunspellSpellcheckerThreadView;
+
+  void ChangeWords(const std::vector<std::string>& words, bool remove);
+
+  // Adds or removes a UTF-8 word in each dictionary, in its encoding. Called
+  // with the lock held for writing.
+  void ChangeWord(const char *word, size_t length, bool remove);
+
+  // Adds and removes the words of the personal dictionary, in the order they
+  // were written. Called with the lock held for writing.
+  void LoadPersonalDictionary();
+
+  void AppendToPersonalDictionary(const std::vector<std::string>& words, bool removed);
+
+  // Held for reading while checking and for writing while changing the
+  // dictionary, so thread views can check at the same time. Dictionaries are
+  // loaded without it, and only swapped in with it held.
+  uv_rwlock_t lock;
+  std::vector<HunspellLanguage> languages;
   Transcoder *transcoder;
-  Transcoder *toDictionaryTranscoder;
-  Transcoder *fromDictionaryTranscoder;
+  DictionaryTranscoders dictionaryTranscoders;
+
+  // Splits words on the word characters of all the dictionaries.
+  WordSegmenter segmenter;
+
+  // The file the words added and removed are kept in, if any.
+  std::string personalDictionaryPath;
+
+  IgnorePatternSet ignorePatterns;
+
+  // Cleared whenever the words of the dictionary change.
+  VerdictCache verdicts;
+  SuggestionCache suggestions;
 };
 
 }  // namespace spellchecker
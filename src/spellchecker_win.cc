@@ -13,6 +13,7 @@
 #include "spellchecker.h"
 #include "spellchecker_win.h"
 #include "spellchecker_hunspell.h"
+#include "lock.h"
 
 // NB: No idea why I have to define this myself, you don't have to in a
 // standard console app.
@@ -58,22 +59,6 @@ std::wstring ToWString(const std::string& string) {
   return ret;
 }
 
-class Lock {
-public:
-  Lock(uv_mutex_t &m) : m{m}
-  {
-    uv_mutex_lock(&this->m);
-  }
-
-  ~Lock()
-  {
-    uv_mutex_unlock(&this->m);
-  }
-
-private:
-  uv_mutex_t &m;
-};
-
 std::vector<MisspelledRange> DoCheckSpelling(ISpellChecker *spellchecker, const uint16_t *text, size_t length)
 {
   std::vector<MisspelledRange> result;
@@ -105,6 +90,43 @@ std::vector<MisspelledRange> DoCheckSpelling(ISpellChecker *spellchecker, const
   return result;
 }
 
+// Returns at most maxSuggestions corrections, or all of them if it is 0.
+std::vector<std::string> DoGetCorrectionsForMisspelling(ISpellChecker *spellchecker, const std::string& word, size_t maxSuggestions)
+{
+  if (spellchecker == NULL) {
+    return std::vector<std::string>();
+  }
+
+  std::wstring& wword = ToWString(word);
+  IEnumString* words = NULL;
+
+  HRESULT hr = spellchecker->Suggest(wword.c_str(), &words);
+
+  if (FAILED(hr)) {
+    return std::vector<std::string>();
+  }
+
+  // NB: S_FALSE == word is spelled correctly
+  if (hr == S_FALSE) {
+    words->Release();
+    return std::vector<std::string>();
+  }
+
+  std::vector<std::string> ret;
+
+  LPOLESTR correction;
+  while ((maxSuggestions == 0 || ret.size() < maxSuggestions) && words->Next(1, &correction, NULL) == S_OK) {
+    std::wstring wcorr;
+    wcorr.assign(correction);
+    ret.push_back(ToUTF8(wcorr));
+
+    CoTaskMemFree(correction);
+  }
+
+  words->Release();
+  return ret;
+}
+
 WindowsSpellcheckerThreadView::WindowsSpellcheckerThreadView(WindowsSpellchecker *impl, DWORD spellcheckerCookie) :
   SpellcheckerThreadView(impl),
   spellchecker{NULL}
@@ -150,6 +172,11 @@ std::vector<MisspelledRange> WindowsSpellcheckerThreadView::CheckSpelling(const
   return DoCheckSpelling(spellchecker, text, length);
 }
 
+std::vector<std::string> WindowsSpellcheckerThreadView::GetCorrectionsForMisspelling(const std::string& word, const SuggestionOptions& options)
+{
+  return DoGetCorrectionsForMisspelling(spellchecker, word, options.maxSuggestions);
+}
+
 WindowsSpellchecker::WindowsSpellchecker() {
   this->gTable = NULL;
   this->currentSpellcheckerCookie = 0;
@@ -356,38 +383,7 @@ void WindowsSpellchecker::Remove(const std::string& word) {
 
 
 std::vector<std::string> WindowsSpellchecker::GetCorrectionsForMisspelling(const std::string& word) {
-  if (this->currentSpellchecker == NULL) {
-    return std::vector<std::string>();
-  }
-
-  std::wstring& wword = ToWString(word);
-  IEnumString* words = NULL;
-
-  HRESULT hr = this->currentSpellchecker->Suggest(wword.c_str(), &words);
-
-  if (FAILED(hr)) {
-    return std::vector<std::string>();
-  }
-
-  // NB: S_FALSE == word is spelled correctly
-  if (hr == S_FALSE) {
-    words->Release();
-    return std::vector<std::string>();
-  }
-
-  std::vector<std::string> ret;
-
-  LPOLESTR correction;
-  while (words->Next(1, &correction, NULL) == S_OK) {
-    std::wstring wcorr;
-    wcorr.assign(correction);
-    ret.push_back(ToUTF8(wcorr));
-
-    CoTaskMemFree(correction);
-  }
-
-  words->Release();
-  return ret;
+  return DoGetCorrectionsForMisspelling(this->currentSpellchecker, word, 0);
 }
 
 std::unique_ptr<SpellcheckerThreadView> WindowsSpellchecker::CreateThreadView() {
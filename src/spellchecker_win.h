@@ -18,6 +18,7 @@ public:
   ~WindowsSpellcheckerThreadView() override;
 
   std::vector<MisspelledRange> CheckSpelling(const uint16_t *text, size_t length) override;
+  std::vector<std::string> GetCorrectionsForMisspelling(const std::string& word, const SuggestionOptions& options) override;
 
 private:
   HRESULT initResult;
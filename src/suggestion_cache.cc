@@ -0,0 +1,68 @@
+#include "suggestion_cache.h"
+#include "lock.h"
+
+namespace spellchecker {
+
+namespace {
+
+// Suggestions are only asked for the words a user looks at, so a few hundred
+// cover any session.
+const size_t kMaxEntries = 512;
+
+}  // namespace
+
+SuggestionCache::SuggestionCache() : hits(0), misses(0) {
+  uv_mutex_init(&mutex);
+}
+
+SuggestionCache::~SuggestionCache() {
+  uv_mutex_destroy(&mutex);
+}
+
+bool SuggestionCache::Find(const std::string& word, std::vector<std::string> *corrections) {
+  Lock lock(mutex);
+
+  auto found = index.find(word);
+  if (found == index.end()) {
+    misses++;
+    return false;
+  }
+
+  entries.splice(entries.begin(), entries, found->second);
+  *corrections = found->second->second;
+  hits++;
+  return true;
+}
+
+void SuggestionCache::Insert(const std::string& word, const std::vector<std::string>& corrections) {
+  Lock lock(mutex);
+
+  // Another thread may have found the same corrections meanwhile.
+  if (index.count(word)) {
+    return;
+  }
+
+  if (entries.size() >= kMaxEntries) {
+    index.erase(entries.back().first);
+    entries.pop_back();
+  }
+
+  entries.push_front(std::make_pair(word, corrections));
+  index[word] = entries.begin();
+}
+
+void SuggestionCache::Clear() {
+  Lock lock(mutex);
+
+  entries.clear();
+  index.clear();
+}
+
+CacheStats SuggestionCache::GetStats() {
+  Lock lock(mutex);
+
+  CacheStats stats = {hits, misses, entries.size()};
+  return stats;
+}
+
+}  // namespace spellchecker
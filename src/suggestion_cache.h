@@ -0,0 +1,51 @@
+#ifndef SRC_SUGGESTION_CACHE_H_
+#define SRC_SUGGESTION_CACHE_H_
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <uv.h>
+#include "spellchecker.h"
+
+namespace spellchecker {
+
+// Remembers the corrections of the last misspelled words, which take
+// Hunspell up to a quarter of a second each to find. Suggestions are asked
+// for again and again for the same words, such as each time the menu of a
+// misspelled word is opened.
+//
+// The least recently used words are dropped once the cache is full.
+class SuggestionCache {
+public:
+  SuggestionCache();
+  ~SuggestionCache();
+
+  // Looks up the corrections of a UTF-8 word. Returns false if the cache
+  // does not have them.
+  bool Find(const std::string& word, std::vector<std::string> *corrections);
+
+  void Insert(const std::string& word, const std::vector<std::string>& corrections);
+
+  // Forgets every word, for when the words of the dictionary change.
+  void Clear();
+
+  CacheStats GetStats();
+
+private:
+  typedef std::list<std::pair<std::string, std::vector<std::string>>> EntryList;
+
+  uv_mutex_t mutex;
+
+  // The entries, most recently used first.
+  EntryList entries;
+  std::unordered_map<std::string, EntryList::iterator> index;
+
+  uint64_t hits;
+  uint64_t misses;
+};
+
+}  // namespace spellchecker
+
+#endif  // SRC_SUGGESTION_CACHE_H_
@@ -0,0 +1,226 @@
+#include <cstring>
+#include <algorithm>
+#include "surface_forms.h"
+
+namespace spellchecker {
+
+namespace {
+
+// The hashes a word is placed by.
+struct WordHash {
+  uint32_t bucketKey;
+  uint32_t firstKey;
+  uint32_t stepKey;
+  uint32_t check;
+};
+
+uint64_t Mix(uint64_t value) {
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+  return value ^ (value >> 31);
+}
+
+WordHash HashWord(const char *word, size_t length) {
+  uint64_t hash = 14695981039346656037ull;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ static_cast<unsigned char>(word[i])) * 1099511628211ull;
+  }
+
+  uint64_t first = Mix(hash);
+  uint64_t second = Mix(hash ^ 0x9e3779b97f4a7c15ull);
+
+  WordHash result = {
+    static_cast<uint32_t>(first >> 32),
+    static_cast<uint32_t>(first),
+    static_cast<uint32_t>(second),
+    static_cast<uint32_t>(second >> 32),
+  };
+  return result;
+}
+
+// Maps a hash onto [0, count) without dividing.
+uint32_t Reduce(uint32_t hash, uint32_t count) {
+  return static_cast<uint32_t>((static_cast<uint64_t>(hash) * count) >> 32);
+}
+
+// The slot of a word for a displacement. The slot count is prime, so the
+// slots of a word for the displacements from 0 go through every slot.
+uint32_t GetSlot(const WordHash& hash, uint32_t displacement, uint32_t slotCount) {
+  uint64_t first = Reduce(hash.firstKey, slotCount);
+  uint64_t step = 1 + Reduce(hash.stepKey, slotCount - 1);
+  return static_cast<uint32_t>((first + displacement * step) % slotCount);
+}
+
+bool IsPrime(uint32_t value) {
+  for (uint32_t divisor = 2; divisor * divisor <= value; divisor++) {
+    if (value % divisor == 0) {
+      return false;
+    }
+  }
+
+  return value >= 2;
+}
+
+}  // namespace
+
+const uint32_t SurfaceFormSet::kEmptySlot;
+
+SurfaceFormSet::SurfaceFormSet() : header(NULL), displacements(NULL), slots(NULL), pool(NULL) {
+}
+
+bool SurfaceFormSet::BuildImage(const std::vector<std::string>& words, std::vector<char> *image) {
+  if (words.size() > 0x10000000) {
+    return false;
+  }
+
+  // Buckets of about four words, and a tenth of the slots left empty, which
+  // the words of the last buckets, placed alone, are sure to find quickly.
+  Header header;
+  header.wordCount = static_cast<uint32_t>(words.size());
+  header.bucketCount = std::max<uint32_t>(header.wordCount / 4, 1);
+  header.slotCount = std::max<uint32_t>(header.wordCount + header.wordCount / 9 + 1, 3);
+  while (!IsPrime(header.slotCount)) {
+    header.slotCount++;
+  }
+
+  std::vector<WordHash> hashes(words.size());
+  std::vector<std::vector<uint32_t>> buckets(header.bucketCount);
+  uint64_t poolSize = 0;
+
+  for (size_t i = 0; i < words.size(); i++) {
+    if (words[i].empty() || words[i].size() > 255) {
+      return false;
+    }
+
+    hashes[i] = HashWord(words[i].data(), words[i].size());
+    buckets[Reduce(hashes[i].bucketKey, header.bucketCount)].push_back(static_cast<uint32_t>(i));
+    poolSize += 1 + words[i].size();
+  }
+
+  if (poolSize >= kEmptySlot) {
+    return false;
+  }
+
+  header.poolSize = static_cast<uint32_t>(poolSize);
+
+  // Place the largest buckets first, while most slots are free.
+  std::vector<uint32_t> order(header.bucketCount);
+  for (uint32_t i = 0; i < header.bucketCount; i++) {
+    order[i] = i;
+  }
+
+  std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+    return buckets[a].size() > buckets[b].size();
+  });
+
+  std::vector<uint32_t> bucketDisplacements(header.bucketCount, 0);
+  std::vector<uint32_t> slotWords(header.slotCount, kEmptySlot);
+  std::vector<uint32_t> placed;
+
+  for (auto iter = order.begin(); iter != order.end() && !buckets[*iter].empty(); ++iter) {
+    const std::vector<uint32_t>& bucket = buckets[*iter];
+    uint32_t displacement = 0;
+
+    for (;; displacement++) {
+      if (displacement == header.slotCount) {
+        return false;
+      }
+
+      placed.clear();
+      for (auto word = bucket.begin(); word != bucket.end(); ++word) {
+        uint32_t slot = GetSlot(hashes[*word], displacement, header.slotCount);
+        if (slotWords[slot] != kEmptySlot || std::find(placed.begin(), placed.end(), slot) != placed.end()) {
+          break;
+        }
+
+        placed.push_back(slot);
+      }
+
+      if (placed.size() == bucket.size()) {
+        break;
+      }
+    }
+
+    bucketDisplacements[*iter] = displacement;
+    for (size_t i = 0; i < bucket.size(); i++) {
+      slotWords[placed[i]] = bucket[i];
+    }
+  }
+
+  image->resize(sizeof(Header) + header.bucketCount * sizeof(uint32_t) + header.slotCount * sizeof(Slot) + header.poolSize);
+  char *data = image->data();
+
+  memcpy(data, &header, sizeof(Header));
+  data += sizeof(Header);
+
+  memcpy(data, bucketDisplacements.data(), header.bucketCount * sizeof(uint32_t));
+  data += header.bucketCount * sizeof(uint32_t);
+
+  std::vector<uint32_t> offsets(words.size());
+  char *poolData = data + header.slotCount * sizeof(Slot);
+  uint32_t offset = 0;
+
+  for (size_t i = 0; i < words.size(); i++) {
+    offsets[i] = offset;
+    poolData[offset] = static_cast<char>(words[i].size());
+    memcpy(poolData + offset + 1, words[i].data(), words[i].size());
+    offset += static_cast<uint32_t>(1 + words[i].size());
+  }
+
+  for (uint32_t i = 0; i < header.slotCount; i++) {
+    Slot slot = {0, kEmptySlot};
+    if (slotWords[i] != kEmptySlot) {
+      slot.check = hashes[slotWords[i]].check;
+      slot.offset = offsets[slotWords[i]];
+    }
+
+    memcpy(data + i * sizeof(Slot), &slot, sizeof(Slot));
+  }
+
+  return true;
+}
+
+bool SurfaceFormSet::Open(const char *data, size_t size) {
+  header = NULL;
+
+  const Header *candidate = reinterpret_cast<const Header *>(data);
+  if (size < sizeof(Header) || reinterpret_cast<uintptr_t>(data) % sizeof(uint32_t) != 0) {
+    return false;
+  }
+
+  uint64_t expected = sizeof(Header) + static_cast<uint64_t>(candidate->bucketCount) * sizeof(uint32_t) +
+    static_cast<uint64_t>(candidate->slotCount) * sizeof(Slot) + candidate->poolSize;
+
+  if (candidate->bucketCount == 0 || candidate->slotCount == 0 || expected != size) {
+    return false;
+  }
+
+  header = candidate;
+  displacements = reinterpret_cast<const uint32_t *>(data + sizeof(Header));
+  slots = reinterpret_cast<const Slot *>(displacements + header->bucketCount);
+  pool = reinterpret_cast<const uint8_t *>(slots + header->slotCount);
+  return true;
+}
+
+bool SurfaceFormSet::Contains(const char *word, size_t length) const {
+  if (!header || length == 0 || length > 255) {
+    return false;
+  }
+
+  WordHash hash = HashWord(word, length);
+  uint32_t displacement = displacements[Reduce(hash.bucketKey, header->bucketCount)];
+  const Slot& slot = slots[GetSlot(hash, displacement, header->slotCount)];
+
+  if (slot.check != hash.check || slot.offset == kEmptySlot ||
+      static_cast<uint64_t>(slot.offset) + 1 + length > header->poolSize) {
+    return false;
+  }
+
+  return pool[slot.offset] == length && memcmp(pool + slot.offset + 1, word, length) == 0;
+}
+
+size_t SurfaceFormSet::GetSize() const {
+  return header ? header->wordCount : 0;
+}
+
+}  // namespace spellchecker
@@ -0,0 +1,62 @@
+#ifndef SRC_SURFACE_FORMS_H_
+#define SRC_SURFACE_FORMS_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace spellchecker {
+
+// A set of words known to be spelled correctly, such as the commonest forms
+// of the words of a dictionary with their affixes, so that checking them
+// takes one probe instead of the affix rules of the dictionary.
+//
+// The set is read in place from an image, such as a mapped file. The words
+// are placed by a perfect hash: the hash of a word picks a bucket, and the
+// displacement of its bucket, found when building the image, the one slot
+// the word can be in. The slot holds another hash of the word, so most words
+// not in the set are told apart without reading the word it points to.
+class SurfaceFormSet {
+public:
+  SurfaceFormSet();
+
+  // Builds the image of a set of distinct UTF-8 words, each at most 255 bytes
+  // long. Returns false if there are too many or too long words.
+  static bool BuildImage(const std::vector<std::string>& words, std::vector<char> *image);
+
+  // Reads the set from an image made by BuildImage, which must outlive it.
+  // Returns false, leaving the set empty, if the image is not valid.
+  bool Open(const char *data, size_t size);
+
+  bool Contains(const char *word, size_t length) const;
+
+  size_t GetSize() const;
+
+private:
+  struct Header {
+    uint32_t wordCount;
+    uint32_t bucketCount;
+    uint32_t slotCount;
+    uint32_t poolSize;
+  };
+
+  struct Slot {
+    uint32_t check;
+
+    // Where the word is in the pool, as its length byte followed by its
+    // bytes, or kEmptySlot.
+    uint32_t offset;
+  };
+
+  static const uint32_t kEmptySlot = 0xffffffff;
+
+  const Header *header;
+  const uint32_t *displacements;
+  const Slot *slots;
+  const uint8_t *pool;
+};
+
+}  // namespace spellchecker
+
+#endif  // SRC_SURFACE_FORMS_H_
@@ -1,12 +1,18 @@
+#include <cerrno>
 #include <cstring>
 #include <iconv.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include "buffers.h"
+#include "code_page.h"
 
 namespace spellchecker {
 
 struct Transcoder {
+  // Set for conversions between UTF-8 and a single-byte code page, which are
+  // made with its tables. The other conversions go through iconv.
+  CodePage *code_page;
+  bool to_code_page;
   iconv_t conversion;
 };
 
@@ -20,54 +26,93 @@ static int IsBigEndian(void) {
   return two_byte_value.bytes[0] == 1;
 }
 
-Transcoder *NewUTF16ToUTF8Transcoder() {
-  const char *to_encoding = "UTF-8";
-  const char *from_encoding = IsBigEndian() ? "UTF-16BE" : "UTF-16LE";
-  iconv_t conversion = iconv_open(to_encoding, from_encoding);
+// Reads the character of each byte of an encoding with iconv. Returns NULL
+// if the encoding is unknown or is not a single-byte one.
+static CodePage *LoadCodePage(const char *encoding) {
+  iconv_t conversion = iconv_open(IsBigEndian() ? "UTF-32BE" : "UTF-32LE", encoding);
   if (conversion == (iconv_t)-1) {
     return NULL;
   }
 
+  uint32_t characters[256];
+  bool single_byte = true;
+
+  for (int byte = 0; byte < 256 && single_byte; byte++) {
+    char in = static_cast<char>(byte);
+    char *in_pointer = &in;
+    size_t in_bytes = 1;
+    char *out_pointer = reinterpret_cast<char *>(&characters[byte]);
+    size_t out_bytes = sizeof(uint32_t);
+
+    // Start each byte from the initial state.
+    iconv(conversion, NULL, NULL, NULL, NULL);
+    size_t iconv_result = iconv(conversion, &in_pointer, &in_bytes, &out_pointer, &out_bytes);
+
+    if (iconv_result == static_cast<size_t>(-1)) {
+      // A byte with no character is fine, but one that starts a sequence of
+      // bytes means the tables cannot be used.
+      if (errno == EILSEQ) {
+        characters[byte] = CODE_PAGE_UNMAPPED;
+      } else {
+        single_byte = false;
+      }
+    } else if (out_bytes != 0) {
+      single_byte = false;
+    }
+  }
+
+  iconv_close(conversion);
+  return single_byte ? NewCodePage(characters) : NULL;
+}
+
+Transcoder *NewUTF16ToUTF8Transcoder() {
+  // UTF-16 is converted without iconv or tables.
   Transcoder *result = new Transcoder();
-  result->conversion = conversion;
+  result->code_page = NULL;
+  result->to_code_page = false;
+  result->conversion = (iconv_t)-1;
   return result;
 }
 
 Transcoder *NewTranscoder8to8(const char *from_encoding, const char *to_encoding) {
-  iconv_t conversion = iconv_open(to_encoding, from_encoding);
-  
-  if (conversion == (iconv_t)-1) {
-    return NULL;
+  Transcoder *result = new Transcoder();
+  result->code_page = NULL;
+  result->to_code_page = IsUTF8EncodingName(from_encoding);
+  result->conversion = (iconv_t)-1;
+
+  if (IsUTF8EncodingName(from_encoding) != IsUTF8EncodingName(to_encoding)) {
+    result->code_page = LoadCodePage(result->to_code_page ? to_encoding : from_encoding);
+  }
+
+  if (!result->code_page) {
+    result->conversion = iconv_open(to_encoding, from_encoding);
+
+    if (result->conversion == (iconv_t)-1) {
+      delete result;
+      return NULL;
+    }
   }
 
-  Transcoder *result = new Transcoder();
-  result->conversion = conversion;
   return result;
 }
 
 void FreeTranscoder(Transcoder *transcoder) {
-  iconv_close(transcoder->conversion);
+  if (transcoder->code_page) {
+    FreeCodePage(transcoder->code_page);
+  }
+
+  if (transcoder->conversion != (iconv_t)-1) {
+    iconv_close(transcoder->conversion);
+  }
+
   delete transcoder;
 }
 
 bool TranscodeUTF16ToUTF8(const Transcoder *transcoder, char *out, size_t out_bytes, const uint16_t *in, size_t in_length) {
-  char *utf16_word = reinterpret_cast<char *>(const_cast<uint16_t *>(in));
-  size_t utf16_bytes = in_length * (sizeof(uint16_t) / sizeof(char));
-
-  size_t iconv_result = iconv(
-    transcoder->conversion,
-    &utf16_word,
-    &utf16_bytes,
-    &out,
-    &out_bytes
-  );
-
-  if (iconv_result == static_cast<size_t>(-1)) {
+  if (!EncodeUTF16ToUTF8(out, out_bytes, in, in_length)) {
     return false;
   }
 
-  *out = '\0';
-
   // Make sure the transcoded length doesn't exceed our buffers.
   return strlen(out) <= MAX_UTF8_BUFFER;
 }
@@ -82,6 +127,15 @@ bool Transcode8to8(const Transcoder *transcoder, char *out, size_t out_length, c
     // Copy the string and add the terminating character.
     std::memcpy(out, in, in_length);
     out[in_length] = '\0';
+  } else if (transcoder->code_page) {
+    // Convert between UTF-8 and the code page with its tables.
+    bool converted = transcoder->to_code_page ?
+      EncodeUTF8ToCodePage(transcoder->code_page, out, out_length, in, in_length) :
+      DecodeCodePageToUTF8(transcoder->code_page, out, out_length, in, in_length);
+
+    if (!converted) {
+      return false;
+    }
   } else {
     // We have a transcoder, so transcode the contents.
     size_t iconv_result = iconv(
@@ -5,12 +5,18 @@
 #include <stdlib.h>
 #include "transcoder.h"
 #include "buffers.h"
+#include "code_page.h"
 
 namespace spellchecker {
 
 struct Transcoder {
   UINT from_code_page;
   UINT to_code_page;
+
+  // Set for conversions between UTF-8 and a single-byte code page, which are
+  // made with its tables instead of through UTF-16.
+  CodePage *code_page;
+  bool to_code_page_table;
 };
 
 // Pulled from csutil.cxx.
@@ -127,24 +133,60 @@ UINT GetCodePage(const char *dictionary_encoding) {
   return -1;
 }
 
+// Reads the character of each byte of a code page. Returns NULL if it is
+// not a single-byte one.
+CodePage *LoadCodePage(UINT code_page) {
+  CPINFO info;
+  if (code_page == CP_UTF8 || !GetCPInfo(code_page, &info) || info.MaxCharSize != 1) {
+    return NULL;
+  }
+
+  uint32_t characters[256];
+
+  for (int byte = 0; byte < 256; byte++) {
+    char in = static_cast<char>(byte);
+    wchar_t out[2];
+
+    int length = MultiByteToWideChar(code_page, MB_ERR_INVALID_CHARS, &in, 1, out, 2);
+    characters[byte] = length == 1 ? out[0] : CODE_PAGE_UNMAPPED;
+  }
+
+  return NewCodePage(characters);
+}
+
 Transcoder* NewUTF16ToUTF8Transcoder() {
-  return new Transcoder();
+  // UTF-16 is converted without Windows or tables.
+  Transcoder *result = new Transcoder();
+  result->code_page = NULL;
+  return result;
 }
 
 Transcoder* NewTranscoder8to8(const char *from_encoding, const char *to_encoding) {
   Transcoder *result = new Transcoder();
   result->from_code_page = GetCodePage(from_encoding);
   result->to_code_page = GetCodePage(to_encoding);
+  result->code_page = NULL;
+  result->to_code_page_table = result->from_code_page == CP_UTF8;
+
+  if ((result->from_code_page == CP_UTF8) != (result->to_code_page == CP_UTF8)) {
+    result->code_page = LoadCodePage(result->to_code_page_table ? result->to_code_page : result->from_code_page);
+  }
+
   return result;
 }
 
 void FreeTranscoder(Transcoder *transcoder) {
+  if (transcoder->code_page) {
+    FreeCodePage(transcoder->code_page);
+  }
+
   delete transcoder;
 }
 
 bool TranscodeUTF16ToUTF8(const Transcoder *transcoder, char *out, size_t out_length, const uint16_t *in, size_t in_length) {
-  int length = WideCharToMultiByte(CP_UTF8, 0, reinterpret_cast<const wchar_t *>(in), in_length, out, out_length, NULL, NULL);
-  out[length] = '\0';
+  if (!EncodeUTF16ToUTF8(out, out_length, in, in_length)) {
+    return false;
+  }
 
   // Make sure the transcoded length doesn't exceed our buffers.
   return strlen(out) <= MAX_UTF8_BUFFER;
@@ -158,6 +200,15 @@ bool Transcode8to8(const Transcoder *transcoder, char *out, size_t out_length, c
     // Copy the string and add the terminating character.
     std::memcpy(out, in, in_length);
     out[in_length] = '\0';
+  } else if (transcoder->code_page) {
+    // Convert between UTF-8 and the code page with its tables.
+    bool converted = transcoder->to_code_page_table ?
+      EncodeUTF8ToCodePage(transcoder->code_page, out, out_length, in, in_length) :
+      DecodeCodePageToUTF8(transcoder->code_page, out, out_length, in, in_length);
+
+    if (!converted) {
+      return false;
+    }
   } else {
     // There is no easy way to convert from these two formats, so we convert from
     // the input format into UTF-16 (wstring) first which appears to be the "right"
@@ -0,0 +1,149 @@
+#include <cstring>
+#include "verdict_cache.h"
+#include "lock.h"
+
+namespace spellchecker {
+
+namespace {
+
+// FNV-1a, which is quick for the short words kept.
+uint32_t HashWord(const char *word, size_t length) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ static_cast<unsigned char>(word[i])) * 16777619u;
+  }
+
+  return hash;
+}
+
+}  // namespace
+
+VerdictCache::VerdictCache() : generation(1) {
+  for (size_t i = 0; i < kShardCount; i++) {
+    Shard& shard = shards[i];
+
+    uv_mutex_init(&shard.mutex);
+    memset(shard.entries, 0, sizeof(shard.entries));
+    memset(shard.hands, 0, sizeof(shard.hands));
+    shard.hits = 0;
+    shard.misses = 0;
+    shard.size = 0;
+  }
+}
+
+VerdictCache::~VerdictCache() {
+  for (size_t i = 0; i < kShardCount; i++) {
+    uv_mutex_destroy(&shards[i].mutex);
+  }
+}
+
+bool VerdictCache::Find(const char *word, size_t length, bool *misspelled) {
+  if (length > kMaxWordLength) {
+    return false;
+  }
+
+  uint32_t hash = HashWord(word, length);
+  Shard& shard = shards[hash % kShardCount];
+  Entry *set = shard.entries + (hash / kShardCount) % kSetCount * kWayCount;
+
+  Lock lock(shard.mutex);
+
+  for (size_t way = 0; way < kWayCount; way++) {
+    Entry& entry = set[way];
+
+    if (entry.generation == generation && entry.hash == hash && entry.length == length &&
+        memcmp(entry.word, word, length) == 0) {
+      entry.referenced = 1;
+      *misspelled = entry.misspelled != 0;
+      shard.hits++;
+      return true;
+    }
+  }
+
+  shard.misses++;
+  return false;
+}
+
+void VerdictCache::Insert(const char *word, size_t length, bool misspelled) {
+  if (length > kMaxWordLength) {
+    return;
+  }
+
+  uint32_t hash = HashWord(word, length);
+  size_t setIndex = (hash / kShardCount) % kSetCount;
+  Shard& shard = shards[hash % kShardCount];
+  Entry *set = shard.entries + setIndex * kWayCount;
+
+  Lock lock(shard.mutex);
+
+  // Another thread may have checked the same word meanwhile. Otherwise take
+  // a free entry, or the first one the clock finds unused since it last went
+  // past.
+  Entry *victim = NULL;
+  for (size_t way = 0; way < kWayCount; way++) {
+    Entry& entry = set[way];
+
+    if (entry.generation != generation) {
+      if (!victim) {
+        victim = &entry;
+      }
+    } else if (entry.hash == hash && entry.length == length && memcmp(entry.word, word, length) == 0) {
+      return;
+    }
+  }
+
+  if (victim) {
+    shard.size++;
+  } else {
+    uint8_t& hand = shard.hands[setIndex];
+    while (set[hand].referenced) {
+      set[hand].referenced = 0;
+      hand = (hand + 1) % kWayCount;
+    }
+
+    victim = &set[hand];
+    hand = (hand + 1) % kWayCount;
+  }
+
+  victim->hash = hash;
+  victim->generation = generation;
+  victim->length = static_cast<uint8_t>(length);
+  victim->misspelled = misspelled;
+  victim->referenced = 0;
+  memcpy(victim->word, word, length);
+}
+
+void VerdictCache::Clear() {
+  generation++;
+
+  for (size_t i = 0; i < kShardCount; i++) {
+    Shard& shard = shards[i];
+    shard.size = 0;
+
+    // Once the generations wrap around, old entries would look current.
+    if (generation == 0) {
+      memset(shard.entries, 0, sizeof(shard.entries));
+    }
+  }
+
+  if (generation == 0) {
+    generation = 1;
+  }
+}
+
+CacheStats VerdictCache::GetStats() {
+  CacheStats stats = {0, 0, 0};
+
+  for (size_t i = 0; i < kShardCount; i++) {
+    Shard& shard = shards[i];
+    Lock lock(shard.mutex);
+
+    stats.hits += shard.hits;
+    stats.misses += shard.misses;
+    stats.size += shard.size;
+  }
+
+  return stats;
+}
+
+}  // namespace spellchecker
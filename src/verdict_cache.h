@@ -0,0 +1,74 @@
+#ifndef SRC_VERDICT_CACHE_H_
+#define SRC_VERDICT_CACHE_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <uv.h>
+#include "spellchecker.h"
+
+namespace spellchecker {
+
+// Remembers whether words are misspelled, so the few hundred words most of
+// any text is made of are only given to the dictionary once.
+//
+// The cache has a fixed number of entries and holds the words in them, so
+// it never allocates. It is split into shards, each with its own lock, for
+// the threads checking at the same time. A word can be in one of a few
+// entries of its shard, and when they are full the one not used for longest
+// is replaced, by the CLOCK approximation of LRU.
+class VerdictCache {
+public:
+  // The longest word kept, in bytes. Longer words, which are rare, are
+  // always given to the dictionary.
+  static const size_t kMaxWordLength = 21;
+
+  VerdictCache();
+  ~VerdictCache();
+
+  // Looks up a UTF-8 word. Returns false if the cache does not have it.
+  bool Find(const char *word, size_t length, bool *misspelled);
+
+  void Insert(const char *word, size_t length, bool misspelled);
+
+  // Forgets every word. Must not be called during lookups, which the lock of
+  // the spellchecker being held for writing ensures.
+  void Clear();
+
+  CacheStats GetStats();
+
+private:
+  static const size_t kShardCount = 16;
+  static const size_t kSetCount = 64;
+  static const size_t kWayCount = 8;
+
+  struct Entry {
+    uint32_t hash;
+
+    // Entries from before the last clear have an older generation.
+    uint32_t generation;
+
+    uint8_t length;
+    uint8_t misspelled;
+    uint8_t referenced;
+    char word[kMaxWordLength];
+  };
+
+  struct Shard {
+    uv_mutex_t mutex;
+    Entry entries[kSetCount * kWayCount];
+
+    // The way the clock of each set replaces next.
+    uint8_t hands[kSetCount];
+
+    uint64_t hits;
+    uint64_t misses;
+    size_t size;
+  };
+
+  Shard shards[kShardCount];
+  uint32_t generation;
+};
+
+}  // namespace spellchecker
+
+#endif  // SRC_VERDICT_CACHE_H_
@@ -0,0 +1,1346 @@
+// Generated by script/generate-word-characters.py from Unicode 14.0.0. Do not edit.
+
+#include "word_segmenter.h"
+
+namespace spellchecker {
+
+#define O WORD_CHARACTER_OTHER
+#define L WORD_CHARACTER_LETTER
+#define E WORD_CHARACTER_EXTEND
+#define S WORD_CHARACTER_SEPARATOR
+
+const uint8_t kLatin1WordCharacters[256] = {
+  S, O, O, O, O, O, O, O, O, S, S, S, S, S, O, O,  // 00
+  O, O, O, O, O, O, O, O, O, O, O, O, O, O, O, O,  // 10
+  S, S, S, S, S, S, S, S, S, S, S, S, S, S, S, S,  // 20
+  O, O, O, O, O, O, O, O, O, O, S, S, S, S, S, S,  // 30
+  S, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L,  // 40
+  L, L, L, L, L, L, L, L, L, L, L, S, S, S, S, S,  // 50
+  S, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L,  // 60
+  L, L, L, L, L, L, L, L, L, L, L, S, S, S, S, O,  // 70
+  O, O, O, O, O, S, O, O, O, O, O, O, O, O, O, O,  // 80
+  O, O, O, O, O, O, O, O, O, O, O, O, O, O, O, O,  // 90
+  S, S, S, S, S, S, S, S, S, S, L, S, S, E, S, S,  // A0
+  S, S, S, S, S, L, S, S, S, S, L, S, S, S, S, S,  // B0
+  L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L,  // C0
+  L, L, L, L, L, L, L, S, L, L, L, L, L, L, L, L,  // D0
+  L, L, L, L, L, L, L, L, L, L, L, L, L, L, L, L,  // E0
+  L, L, L, L, L, L, L, S, L, L, L, L, L, L, L, L,  // F0
+};
+
+#undef O
+#undef L
+#undef E
+#undef S
+
+const WordCharacterRange kWordCharacterRanges[] = {
+  {0x0100, 0x02C1, WORD_CHARACTER_LETTER},
+  {0x02C2, 0x02C5, WORD_CHARACTER_SEPARATOR},
+  {0x02C6, 0x02D1, WORD_CHARACTER_LETTER},
+  {0x02D2, 0x02DF, WORD_CHARACTER_SEPARATOR},
+  {0x02E0, 0x02E4, WORD_CHARACTER_LETTER},
+  {0x02E5, 0x02EB, WORD_CHARACTER_SEPARATOR},
+  {0x02EC, 0x02EC, WORD_CHARACTER_LETTER},
+  {0x02ED, 0x02ED, WORD_CHARACTER_SEPARATOR},
+  {0x02EE, 0x02EE, WORD_CHARACTER_LETTER},
+  {0x02EF, 0x02FF, WORD_CHARACTER_SEPARATOR},
+  {0x0300, 0x036F, WORD_CHARACTER_EXTEND},
+  {0x0370, 0x0374, WORD_CHARACTER_LETTER},
+  {0x0375, 0x0375, WORD_CHARACTER_SEPARATOR},
+  {0x0376, 0x0377, WORD_CHARACTER_LETTER},
+  {0x037A, 0x037D, WORD_CHARACTER_LETTER},
+  {0x037E, 0x037E, WORD_CHARACTER_SEPARATOR},
+  {0x037F, 0x037F, WORD_CHARACTER_LETTER},
+  {0x0384, 0x0385, WORD_CHARACTER_SEPARATOR},
+  {0x0386, 0x0386, WORD_CHARACTER_LETTER},
+  {0x0387, 0x0387, WORD_CHARACTER_SEPARATOR},
+  {0x0388, 0x038A, WORD_CHARACTER_LETTER},
+  {0x038C, 0x038C, WORD_CHARACTER_LETTER},
+  {0x038E, 0x03A1, WORD_CHARACTER_LETTER},
+  {0x03A3, 0x03F5, WORD_CHARACTER_LETTER},
+  {0x03F6, 0x03F6, WORD_CHARACTER_SEPARATOR},
+  {0x03F7, 0x0481, WORD_CHARACTER_LETTER},
+  {0x0482, 0x0482, WORD_CHARACTER_SEPARATOR},
+  {0x0483, 0x0489, WORD_CHARACTER_EXTEND},
+  {0x048A, 0x052F, WORD_CHARACTER_LETTER},
+  {0x0531, 0x0556, WORD_CHARACTER_LETTER},
+  {0x0559, 0x0559, WORD_CHARACTER_LETTER},
+  {0x055A, 0x055F, WORD_CHARACTER_SEPARATOR},
+  {0x0560, 0x0588, WORD_CHARACTER_LETTER},
+  {0x0589, 0x058A, WORD_CHARACTER_SEPARATOR},
+  {0x058D, 0x058F, WORD_CHARACTER_SEPARATOR},
+  {0x0591, 0x05BD, WORD_CHARACTER_EXTEND},
+  {0x05BE, 0x05BE, WORD_CHARACTER_SEPARATOR},
+  {0x05BF, 0x05BF, WORD_CHARACTER_EXTEND},
+  {0x05C0, 0x05C0, WORD_CHARACTER_SEPARATOR},
+  {0x05C1, 0x05C2, WORD_CHARACTER_EXTEND},
+  {0x05C3, 0x05C3, WORD_CHARACTER_SEPARATOR},
+  {0x05C4, 0x05C5, WORD_CHARACTER_EXTEND},
+  {0x05C6, 0x05C6, WORD_CHARACTER_SEPARATOR},
+  {0x05C7, 0x05C7, WORD_CHARACTER_EXTEND},
+  {0x05D0, 0x05EA, WORD_CHARACTER_LETTER},
+  {0x05EF, 0x05F2, WORD_CHARACTER_LETTER},
+  {0x05F3, 0x05F4, WORD_CHARACTER_SEPARATOR},
+  {0x0600, 0x0605, WORD_CHARACTER_EXTEND},
+  {0x0606, 0x060F, WORD_CHARACTER_SEPARATOR},
+  {0x0610, 0x061A, WORD_CHARACTER_EXTEND},
+  {0x061B, 0x061B, WORD_CHARACTER_SEPARATOR},
+  {0x061C, 0x061C, WORD_CHARACTER_EXTEND},
+  {0x061D, 0x061F, WORD_CHARACTER_SEPARATOR},
+  {0x0620, 0x064A, WORD_CHARACTER_LETTER},
+  {0x064B, 0x065F, WORD_CHARACTER_EXTEND},
+  {0x066A, 0x066D, WORD_CHARACTER_SEPARATOR},
+  {0x066E, 0x066F, WORD_CHARACTER_LETTER},
+  {0x0670, 0x0670, WORD_CHARACTER_EXTEND},
+  {0x0671, 0x06D3, WORD_CHARACTER_LETTER},
+  {0x06D4, 0x06D4, WORD_CHARACTER_SEPARATOR},
+  {0x06D5, 0x06D5, WORD_CHARACTER_LETTER},
+  {0x06D6, 0x06DD, WORD_CHARACTER_EXTEND},
+  {0x06DE, 0x06DE, WORD_CHARACTER_SEPARATOR},
+  {0x06DF, 0x06E4, WORD_CHARACTER_EXTEND},
+  {0x06E5, 0x06E6, WORD_CHARACTER_LETTER},
+  {0x06E7, 0x06E8, WORD_CHARACTER_EXTEND},
+  {0x06E9, 0x06E9, WORD_CHARACTER_SEPARATOR},
+  {0x06EA, 0x06ED, WORD_CHARACTER_EXTEND},
+  {0x06EE, 0x06EF, WORD_CHARACTER_LETTER},
+  {0x06FA, 0x06FC, WORD_CHARACTER_LETTER},
+  {0x06FD, 0x06FE, WORD_CHARACTER_SEPARATOR},
+  {0x06FF, 0x06FF, WORD_CHARACTER_LETTER},
+  {0x0700, 0x070D, WORD_CHARACTER_SEPARATOR},
+  {0x070F, 0x070F, WORD_CHARACTER_EXTEND},
+  {0x0710, 0x0710, WORD_CHARACTER_LETTER},
+  {0x0711, 0x0711, WORD_CHARACTER_EXTEND},
+  {0x0712, 0x072F, WORD_CHARACTER_LETTER},
+  {0x0730, 0x074A, WORD_CHARACTER_EXTEND},
+  {0x074D, 0x07A5, WORD_CHARACTER_LETTER},
+  {0x07A6, 0x07B0, WORD_CHARACTER_EXTEND},
+  {0x07B1, 0x07B1, WORD_CHARACTER_LETTER},
+  {0x07CA, 0x07EA, WORD_CHARACTER_LETTER},
+  {0x07EB, 0x07F3, WORD_CHARACTER_EXTEND},
+  {0x07F4, 0x07F5, WORD_CHARACTER_LETTER},
+  {0x07F6, 0x07F9, WORD_CHARACTER_SEPARATOR},
+  {0x07FA, 0x07FA, WORD_CHARACTER_LETTER},
+  {0x07FD, 0x07FD, WORD_CHARACTER_EXTEND},
+  {0x07FE, 0x07FF, WORD_CHARACTER_SEPARATOR},
+  {0x0800, 0x0815, WORD_CHARACTER_LETTER},
+  {0x0816, 0x0819, WORD_CHARACTER_EXTEND},
+  {0x081A, 0x081A, WORD_CHARACTER_LETTER},
+  {0x081B, 0x0823, WORD_CHARACTER_EXTEND},
+  {0x0824, 0x0824, WORD_CHARACTER_LETTER},
+  {0x0825, 0x0827, WORD_CHARACTER_EXTEND},
+  {0x0828, 0x0828, WORD_CHARACTER_LETTER},
+  {0x0829, 0x082D, WORD_CHARACTER_EXTEND},
+  {0x0830, 0x083E, WORD_CHARACTER_SEPARATOR},
+  {0x0840, 0x0858, WORD_CHARACTER_LETTER},
+  {0x0859, 0x085B, WORD_CHARACTER_EXTEND},
+  {0x085E, 0x085E, WORD_CHARACTER_SEPARATOR},
+  {0x0860, 0x086A, WORD_CHARACTER_LETTER},
+  {0x0870, 0x0887, WORD_CHARACTER_LETTER},
+  {0x0888, 0x0888, WORD_CHARACTER_SEPARATOR},
+  {0x0889, 0x088E, WORD_CHARACTER_LETTER},
+  {0x0890, 0x0891, WORD_CHARACTER_EXTEND},
+  {0x0898, 0x089F, WORD_CHARACTER_EXTEND},
+  {0x08A0, 0x08C9, WORD_CHARACTER_LETTER},
+  {0x08CA, 0x0903, WORD_CHARACTER_EXTEND},
+  {0x0904, 0x0939, WORD_CHARACTER_LETTER},
+  {0x093A, 0x093C, WORD_CHARACTER_EXTEND},
+  {0x093D, 0x093D, WORD_CHARACTER_LETTER},
+  {0x093E, 0x094F, WORD_CHARACTER_EXTEND},
+  {0x0950, 0x0950, WORD_CHARACTER_LETTER},
+  {0x0951, 0x0957, WORD_CHARACTER_EXTEND},
+  {0x0958, 0x0961, WORD_CHARACTER_LETTER},
+  {0x0962, 0x0963, WORD_CHARACTER_EXTEND},
+  {0x0964, 0x0965, WORD_CHARACTER_SEPARATOR},
+  {0x0970, 0x0970, WORD_CHARACTER_SEPARATOR},
+  {0x0971, 0x0980, WORD_CHARACTER_LETTER},
+  {0x0981, 0x0983, WORD_CHARACTER_EXTEND},
+  {0x0985, 0x098C, WORD_CHARACTER_LETTER},
+  {0x098F, 0x0990, WORD_CHARACTER_LETTER},
+  {0x0993, 0x09A8, WORD_CHARACTER_LETTER},
+  {0x09AA, 0x09B0, WORD_CHARACTER_LETTER},
+  {0x09B2, 0x09B2, WORD_CHARACTER_LETTER},
+  {0x09B6, 0x09B9, WORD_CHARACTER_LETTER},
+  {0x09BC, 0x09BC, WORD_CHARACTER_EXTEND},
+  {0x09BD, 0x09BD, WORD_CHARACTER_LETTER},
+  {0x09BE, 0x09C4, WORD_CHARACTER_EXTEND},
+  {0x09C7, 0x09C8, WORD_CHARACTER_EXTEND},
+  {0x09CB, 0x09CD, WORD_CHARACTER_EXTEND},
+  {0x09CE, 0x09CE, WORD_CHARACTER_LETTER},
+  {0x09D7, 0x09D7, WORD_CHARACTER_EXTEND},
+  {0x09DC, 0x09DD, WORD_CHARACTER_LETTER},
+  {0x09DF, 0x09E1, WORD_CHARACTER_LETTER},
+  {0x09E2, 0x09E3, WORD_CHARACTER_EXTEND},
+  {0x09F0, 0x09F1, WORD_CHARACTER_LETTER},
+  {0x09F2, 0x09FB, WORD_CHARACTER_SEPARATOR},
+  {0x09FC, 0x09FC, WORD_CHARACTER_LETTER},
+  {0x09FD, 0x09FD, WORD_CHARACTER_SEPARATOR},
+  {0x09FE, 0x09FE, WORD_CHARACTER_EXTEND},
+  {0x0A01, 0x0A03, WORD_CHARACTER_EXTEND},
+  {0x0A05, 0x0A0A, WORD_CHARACTER_LETTER},
+  {0x0A0F, 0x0A10, WORD_CHARACTER_LETTER},
+  {0x0A13, 0x0A28, WORD_CHARACTER_LETTER},
+  {0x0A2A, 0x0A30, WORD_CHARACTER_LETTER},
+  {0x0A32, 0x0A33, WORD_CHARACTER_LETTER},
+  {0x0A35, 0x0A36, WORD_CHARACTER_LETTER},
+  {0x0A38, 0x0A39, WORD_CHARACTER_LETTER},
+  {0x0A3C, 0x0A3C, WORD_CHARACTER_EXTEND},
+  {0x0A3E, 0x0A42, WORD_CHARACTER_EXTEND},
+  {0x0A47, 0x0A48, WORD_CHARACTER_EXTEND},
+  {0x0A4B, 0x0A4D, WORD_CHARACTER_EXTEND},
+  {0x0A51, 0x0A51, WORD_CHARACTER_EXTEND},
+  {0x0A59, 0x0A5C, WORD_CHARACTER_LETTER},
+  {0x0A5E, 0x0A5E, WORD_CHARACTER_LETTER},
+  {0x0A70, 0x0A71, WORD_CHARACTER_EXTEND},
+  {0x0A72, 0x0A74, WORD_CHARACTER_LETTER},
+  {0x0A75, 0x0A75, WORD_CHARACTER_EXTEND},
+  {0x0A76, 0x0A76, WORD_CHARACTER_SEPARATOR},
+  {0x0A81, 0x0A83, WORD_CHARACTER_EXTEND},
+  {0x0A85, 0x0A8D, WORD_CHARACTER_LETTER},
+  {0x0A8F, 0x0A91, WORD_CHARACTER_LETTER},
+  {0x0A93, 0x0AA8, WORD_CHARACTER_LETTER},
+  {0x0AAA, 0x0AB0, WORD_CHARACTER_LETTER},
+  {0x0AB2, 0x0AB3, WORD_CHARACTER_LETTER},
+  {0x0AB5, 0x0AB9, WORD_CHARACTER_LETTER},
+  {0x0ABC, 0x0ABC, WORD_CHARACTER_EXTEND},
+  {0x0ABD, 0x0ABD, WORD_CHARACTER_LETTER},
+  {0x0ABE, 0x0AC5, WORD_CHARACTER_EXTEND},
+  {0x0AC7, 0x0AC9, WORD_CHARACTER_EXTEND},
+  {0x0ACB, 0x0ACD, WORD_CHARACTER_EXTEND},
+  {0x0AD0, 0x0AD0, WORD_CHARACTER_LETTER},
+  {0x0AE0, 0x0AE1, WORD_CHARACTER_LETTER},
+  {0x0AE2, 0x0AE3, WORD_CHARACTER_EXTEND},
+  {0x0AF0, 0x0AF1, WORD_CHARACTER_SEPARATOR},
+  {0x0AF9, 0x0AF9, WORD_CHARACTER_LETTER},
+  {0x0AFA, 0x0AFF, WORD_CHARACTER_EXTEND},
+  {0x0B01, 0x0B03, WORD_CHARACTER_EXTEND},
+  {0x0B05, 0x0B0C, WORD_CHARACTER_LETTER},
+  {0x0B0F, 0x0B10, WORD_CHARACTER_LETTER},
+  {0x0B13, 0x0B28, WORD_CHARACTER_LETTER},
+  {0x0B2A, 0x0B30, WORD_CHARACTER_LETTER},
+  {0x0B32, 0x0B33, WORD_CHARACTER_LETTER},
+  {0x0B35, 0x0B39, WORD_CHARACTER_LETTER},
+  {0x0B3C, 0x0B3C, WORD_CHARACTER_EXTEND},
+  {0x0B3D, 0x0B3D, WORD_CHARACTER_LETTER},
+  {0x0B3E, 0x0B44, WORD_CHARACTER_EXTEND},
+  {0x0B47, 0x0B48, WORD_CHARACTER_EXTEND},
+  {0x0B4B, 0x0B4D, WORD_CHARACTER_EXTEND},
+  {0x0B55, 0x0B57, WORD_CHARACTER_EXTEND},
+  {0x0B5C, 0x0B5D, WORD_CHARACTER_LETTER},
+  {0x0B5F, 0x0B61, WORD_CHARACTER_LETTER},
+  {0x0B62, 0x0B63, WORD_CHARACTER_EXTEND},
+  {0x0B70, 0x0B70, WORD_CHARACTER_SEPARATOR},
+  {0x0B71, 0x0B71, WORD_CHARACTER_LETTER},
+  {0x0B72, 0x0B77, WORD_CHARACTER_SEPARATOR},
+  {0x0B82, 0x0B82, WORD_CHARACTER_EXTEND},
+  {0x0B83, 0x0B83, WORD_CHARACTER_LETTER},
+  {0x0B85, 0x0B8A, WORD_CHARACTER_LETTER},
+  {0x0B8E, 0x0B90, WORD_CHARACTER_LETTER},
+  {0x0B92, 0x0B95, WORD_CHARACTER_LETTER},
+  {0x0B99, 0x0B9A, WORD_CHARACTER_LETTER},
+  {0x0B9C, 0x0B9C, WORD_CHARACTER_LETTER},
+  {0x0B9E, 0x0B9F, WORD_CHARACTER_LETTER},
+  {0x0BA3, 0x0BA4, WORD_CHARACTER_LETTER},
+  {0x0BA8, 0x0BAA, WORD_CHARACTER_LETTER},
+  {0x0BAE, 0x0BB9, WORD_CHARACTER_LETTER},
+  {0x0BBE, 0x0BC2, WORD_CHARACTER_EXTEND},
+  {0x0BC6, 0x0BC8, WORD_CHARACTER_EXTEND},
+  {0x0BCA, 0x0BCD, WORD_CHARACTER_EXTEND},
+  {0x0BD0, 0x0BD0, WORD_CHARACTER_LETTER},
+  {0x0BD7, 0x0BD7, WORD_CHARACTER_EXTEND},
+  {0x0BF0, 0x0BFA, WORD_CHARACTER_SEPARATOR},
+  {0x0C00, 0x0C04, WORD_CHARACTER_EXTEND},
+  {0x0C05, 0x0C0C, WORD_CHARACTER_LETTER},
+  {0x0C0E, 0x0C10, WORD_CHARACTER_LETTER},
+  {0x0C12, 0x0C28, WORD_CHARACTER_LETTER},
+  {0x0C2A, 0x0C39, WORD_CHARACTER_LETTER},
+  {0x0C3C, 0x0C3C, WORD_CHARACTER_EXTEND},
+  {0x0C3D, 0x0C3D, WORD_CHARACTER_LETTER},
+  {0x0C3E, 0x0C44, WORD_CHARACTER_EXTEND},
+  {0x0C46, 0x0C48, WORD_CHARACTER_EXTEND},
+  {0x0C4A, 0x0C4D, WORD_CHARACTER_EXTEND},
+  {0x0C55, 0x0C56, WORD_CHARACTER_EXTEND},
+  {0x0C58, 0x0C5A, WORD_CHARACTER_LETTER},
+  {0x0C5D, 0x0C5D, WORD_CHARACTER_LETTER},
+  {0x0C60, 0x0C61, WORD_CHARACTER_LETTER},
+  {0x0C62, 0x0C63, WORD_CHARACTER_EXTEND},
+  {0x0C77, 0x0C7F, WORD_CHARACTER_SEPARATOR},
+  {0x0C80, 0x0C80, WORD_CHARACTER_LETTER},
+  {0x0C81, 0x0C83, WORD_CHARACTER_EXTEND},
+  {0x0C84, 0x0C84, WORD_CHARACTER_SEPARATOR},
+  {0x0C85, 0x0C8C, WORD_CHARACTER_LETTER},
+  {0x0C8E, 0x0C90, WORD_CHARACTER_LETTER},
+  {0x0C92, 0x0CA8, WORD_CHARACTER_LETTER},
+  {0x0CAA, 0x0CB3, WORD_CHARACTER_LETTER},
+  {0x0CB5, 0x0CB9, WORD_CHARACTER_LETTER},
+  {0x0CBC, 0x0CBC, WORD_CHARACTER_EXTEND},
+  {0x0CBD, 0x0CBD, WORD_CHARACTER_LETTER},
+  {0x0CBE, 0x0CC4, WORD_CHARACTER_EXTEND},
+  {0x0CC6, 0x0CC8, WORD_CHARACTER_EXTEND},
+  {0x0CCA, 0x0CCD, WORD_CHARACTER_EXTEND},
+  {0x0CD5, 0x0CD6, WORD_CHARACTER_EXTEND},
+  {0x0CDD, 0x0CDE, WORD_CHARACTER_LETTER},
+  {0x0CE0, 0x0CE1, WORD_CHARACTER_LETTER},
+  {0x0CE2, 0x0CE3, WORD_CHARACTER_EXTEND},
+  {0x0CF1, 0x0CF2, WORD_CHARACTER_LETTER},
+  {0x0D00, 0x0D03, WORD_CHARACTER_EXTEND},
+  {0x0D04, 0x0D0C, WORD_CHARACTER_LETTER},
+  {0x0D0E, 0x0D10, WORD_CHARACTER_LETTER},
+  {0x0D12, 0x0D3A, WORD_CHARACTER_LETTER},
+  {0x0D3B, 0x0D3C, WORD_CHARACTER_EXTEND},
+  {0x0D3D, 0x0D3D, WORD_CHARACTER_LETTER},
+  {0x0D3E, 0x0D44, WORD_CHARACTER_EXTEND},
+  {0x0D46, 0x0D48, WORD_CHARACTER_EXTEND},
+  {0x0D4A, 0x0D4D, WORD_CHARACTER_EXTEND},
+  {0x0D4E, 0x0D4E, WORD_CHARACTER_LETTER},
+  {0x0D4F, 0x0D4F, WORD_CHARACTER_SEPARATOR},
+  {0x0D54, 0x0D56, WORD_CHARACTER_LETTER},
+  {0x0D57, 0x0D57, WORD_CHARACTER_EXTEND},
+  {0x0D58, 0x0D5E, WORD_CHARACTER_SEPARATOR},
+  {0x0D5F, 0x0D61, WORD_CHARACTER_LETTER},
+  {0x0D62, 0x0D63, WORD_CHARACTER_EXTEND},
+  {0x0D70, 0x0D79, WORD_CHARACTER_SEPARATOR},
+  {0x0D7A, 0x0D7F, WORD_CHARACTER_LETTER},
+  {0x0D81, 0x0D83, WORD_CHARACTER_EXTEND},
+  {0x0D85, 0x0D96, WORD_CHARACTER_LETTER},
+  {0x0D9A, 0x0DB1, WORD_CHARACTER_LETTER},
+  {0x0DB3, 0x0DBB, WORD_CHARACTER_LETTER},
+  {0x0DBD, 0x0DBD, WORD_CHARACTER_LETTER},
+  {0x0DC0, 0x0DC6, WORD_CHARACTER_LETTER},
+  {0x0DCA, 0x0DCA, WORD_CHARACTER_EXTEND},
+  {0x0DCF, 0x0DD4, WORD_CHARACTER_EXTEND},
+  {0x0DD6, 0x0DD6, WORD_CHARACTER_EXTEND},
+  {0x0DD8, 0x0DDF, WORD_CHARACTER_EXTEND},
+  {0x0DF2, 0x0DF3, WORD_CHARACTER_EXTEND},
+  {0x0DF4, 0x0DF4, WORD_CHARACTER_SEPARATOR},
+  {0x0E01, 0x0E30, WORD_CHARACTER_LETTER},
+  {0x0E31, 0x0E31, WORD_CHARACTER_EXTEND},
+  {0x0E32, 0x0E33, WORD_CHARACTER_LETTER},
+  {0x0E34, 0x0E3A, WORD_CHARACTER_EXTEND},
+  {0x0E3F, 0x0E3F, WORD_CHARACTER_SEPARATOR},
+  {0x0E40, 0x0E46, WORD_CHARACTER_LETTER},
+  {0x0E47, 0x0E4E, WORD_CHARACTER_EXTEND},
+  {0x0E4F, 0x0E4F, WORD_CHARACTER_SEPARATOR},
+  {0x0E5A, 0x0E5B, WORD_CHARACTER_SEPARATOR},
+  {0x0E81, 0x0E82, WORD_CHARACTER_LETTER},
+  {0x0E84, 0x0E84, WORD_CHARACTER_LETTER},
+  {0x0E86, 0x0E8A, WORD_CHARACTER_LETTER},
+  {0x0E8C, 0x0EA3, WORD_CHARACTER_LETTER},
+  {0x0EA5, 0x0EA5, WORD_CHARACTER_LETTER},
+  {0x0EA7, 0x0EB0, WORD_CHARACTER_LETTER},
+  {0x0EB1, 0x0EB1, WORD_CHARACTER_EXTEND},
+  {0x0EB2, 0x0EB3, WORD_CHARACTER_LETTER},
+  {0x0EB4, 0x0EBC, WORD_CHARACTER_EXTEND},
+  {0x0EBD, 0x0EBD, WORD_CHARACTER_LETTER},
+  {0x0EC0, 0x0EC4, WORD_CHARACTER_LETTER},
+  {0x0EC6, 0x0EC6, WORD_CHARACTER_LETTER},
+  {0x0EC8, 0x0ECD, WORD_CHARACTER_EXTEND},
+  {0x0EDC, 0x0EDF, WORD_CHARACTER_LETTER},
+  {0x0F00, 0x0F00, WORD_CHARACTER_LETTER},
+  {0x0F01, 0x0F17, WORD_CHARACTER_SEPARATOR},
+  {0x0F18, 0x0F19, WORD_CHARACTER_EXTEND},
+  {0x0F1A, 0x0F1F, WORD_CHARACTER_SEPARATOR},
+  {0x0F2A, 0x0F34, WORD_CHARACTER_SEPARATOR},
+  {0x0F35, 0x0F35, WORD_CHARACTER_EXTEND},
+  {0x0F36, 0x0F36, WORD_CHARACTER_SEPARATOR},
+  {0x0F37, 0x0F37, WORD_CHARACTER_EXTEND},
+  {0x0F38, 0x0F38, WORD_CHARACTER_SEPARATOR},
+  {0x0F39, 0x0F39, WORD_CHARACTER_EXTEND},
+  {0x0F3A, 0x0F3D, WORD_CHARACTER_SEPARATOR},
+  {0x0F3E, 0x0F3F, WORD_CHARACTER_EXTEND},
+  {0x0F40, 0x0F47, WORD_CHARACTER_LETTER},
+  {0x0F49, 0x0F6C, WORD_CHARACTER_LETTER},
+  {0x0F71, 0x0F84, WORD_CHARACTER_EXTEND},
+  {0x0F85, 0x0F85, WORD_CHARACTER_SEPARATOR},
+  {0x0F86, 0x0F87, WORD_CHARACTER_EXTEND},
+  {0x0F88, 0x0F8C, WORD_CHARACTER_LETTER},
+  {0x0F8D, 0x0F97, WORD_CHARACTER_EXTEND},
+  {0x0F99, 0x0FBC, WORD_CHARACTER_EXTEND},
+  {0x0FBE, 0x0FC5, WORD_CHARACTER_SEPARATOR},
+  {0x0FC6, 0x0FC6, WORD_CHARACTER_EXTEND},
+  {0x0FC7, 0x0FCC, WORD_CHARACTER_SEPARATOR},
+  {0x0FCE, 0x0FDA, WORD_CHARACTER_SEPARATOR},
+  {0x1000, 0x102A, WORD_CHARACTER_LETTER},
+  {0x102B, 0x103E, WORD_CHARACTER_EXTEND},
+  {0x103F, 0x103F, WORD_CHARACTER_LETTER},
+  {0x104A, 0x104F, WORD_CHARACTER_SEPARATOR},
+  {0x1050, 0x1055, WORD_CHARACTER_LETTER},
+  {0x1056, 0x1059, WORD_CHARACTER_EXTEND},
+  {0x105A, 0x105D, WORD_CHARACTER_LETTER},
+  {0x105E, 0x1060, WORD_CHARACTER_EXTEND},
+  {0x1061, 0x1061, WORD_CHARACTER_LETTER},
+  {0x1062, 0x1064, WORD_CHARACTER_EXTEND},
+  {0x1065, 0x1066, WORD_CHARACTER_LETTER},
+  {0x1067, 0x106D, WORD_CHARACTER_EXTEND},
+  {0x106E, 0x1070, WORD_CHARACTER_LETTER},
+  {0x1071, 0x1074, WORD_CHARACTER_EXTEND},
+  {0x1075, 0x1081, WORD_CHARACTER_LETTER},
+  {0x1082, 0x108D, WORD_CHARACTER_EXTEND},
+  {0x108E, 0x108E, WORD_CHARACTER_LETTER},
+  {0x108F, 0x108F, WORD_CHARACTER_EXTEND},
+  {0x109A, 0x109D, WORD_CHARACTER_EXTEND},
+  {0x109E, 0x109F, WORD_CHARACTER_SEPARATOR},
+  {0x10A0, 0x10C5, WORD_CHARACTER_LETTER},
+  {0x10C7, 0x10C7, WORD_CHARACTER_LETTER},
+  {0x10CD, 0x10CD, WORD_CHARACTER_LETTER},
+  {0x10D0, 0x10FA, WORD_CHARACTER_LETTER},
+  {0x10FB, 0x10FB, WORD_CHARACTER_SEPARATOR},
+  {0x10FC, 0x1248, WORD_CHARACTER_LETTER},
+  {0x124A, 0x124D, WORD_CHARACTER_LETTER},
+  {0x1250, 0x1256, WORD_CHARACTER_LETTER},
+  {0x1258, 0x1258, WORD_CHARACTER_LETTER},
+  {0x125A, 0x125D, WORD_CHARACTER_LETTER},
+  {0x1260, 0x1288, WORD_CHARACTER_LETTER},
+  {0x128A, 0x128D, WORD_CHARACTER_LETTER},
+  {0x1290, 0x12B0, WORD_CHARACTER_LETTER},
+  {0x12B2, 0x12B5, WORD_CHARACTER_LETTER},
+  {0x12B8, 0x12BE, WORD_CHARACTER_LETTER},
+  {0x12C0, 0x12C0, WORD_CHARACTER_LETTER},
+  {0x12C2, 0x12C5, WORD_CHARACTER_LETTER},
+  {0x12C8, 0x12D6, WORD_CHARACTER_LETTER},
+  {0x12D8, 0x1310, WORD_CHARACTER_LETTER},
+  {0x1312, 0x1315, WORD_CHARACTER_LETTER},
+  {0x1318, 0x135A, WORD_CHARACTER_LETTER},
+  {0x135D, 0x135F, WORD_CHARACTER_EXTEND},
+  {0x1360, 0x137C, WORD_CHARACTER_SEPARATOR},
+  {0x1380, 0x138F, WORD_CHARACTER_LETTER},
+  {0x1390, 0x1399, WORD_CHARACTER_SEPARATOR},
+  {0x13A0, 0x13F5, WORD_CHARACTER_LETTER},
+  {0x13F8, 0x13FD, WORD_CHARACTER_LETTER},
+  {0x1400, 0x1400, WORD_CHARACTER_SEPARATOR},
+  {0x1401, 0x166C, WORD_CHARACTER_LETTER},
+  {0x166D, 0x166E, WORD_CHARACTER_SEPARATOR},
+  {0x166F, 0x167F, WORD_CHARACTER_LETTER},
+  {0x1680, 0x1680, WORD_CHARACTER_SEPARATOR},
+  {0x1681, 0x169A, WORD_CHARACTER_LETTER},
+  {0x169B, 0x169C, WORD_CHARACTER_SEPARATOR},
+  {0x16A0, 0x16EA, WORD_CHARACTER_LETTER},
+  {0x16EB, 0x16ED, WORD_CHARACTER_SEPARATOR},
+  {0x16EE, 0x16F8, WORD_CHARACTER_LETTER},
+  {0x1700, 0x1711, WORD_CHARACTER_LETTER},
+  {0x1712, 0x1715, WORD_CHARACTER_EXTEND},
+  {0x171F, 0x1731, WORD_CHARACTER_LETTER},
+  {0x1732, 0x1734, WORD_CHARACTER_EXTEND},
+  {0x1735, 0x1736, WORD_CHARACTER_SEPARATOR},
+  {0x1740, 0x1751, WORD_CHARACTER_LETTER},
+  {0x1752, 0x1753, WORD_CHARACTER_EXTEND},
+  {0x1760, 0x176C, WORD_CHARACTER_LETTER},
+  {0x176E, 0x1770, WORD_CHARACTER_LETTER},
+  {0x1772, 0x1773, WORD_CHARACTER_EXTEND},
+  {0x1780, 0x17B3, WORD_CHARACTER_LETTER},
+  {0x17B4, 0x17D3, WORD_CHARACTER_EXTEND},
+  {0x17D4, 0x17D6, WORD_CHARACTER_SEPARATOR},
+  {0x17D7, 0x17D7, WORD_CHARACTER_LETTER},
+  {0x17D8, 0x17DB, WORD_CHARACTER_SEPARATOR},
+  {0x17DC, 0x17DC, WORD_CHARACTER_LETTER},
+  {0x17DD, 0x17DD, WORD_CHARACTER_EXTEND},
+  {0x17F0, 0x17F9, WORD_CHARACTER_SEPARATOR},
+  {0x1800, 0x180A, WORD_CHARACTER_SEPARATOR},
+  {0x180B, 0x180F, WORD_CHARACTER_EXTEND},
+  {0x1820, 0x1878, WORD_CHARACTER_LETTER},
+  {0x1880, 0x1884, WORD_CHARACTER_LETTER},
+  {0x1885, 0x1886, WORD_CHARACTER_EXTEND},
+  {0x1887, 0x18A8, WORD_CHARACTER_LETTER},
+  {0x18A9, 0x18A9, WORD_CHARACTER_EXTEND},
+  {0x18AA, 0x18AA, WORD_CHARACTER_LETTER},
+  {0x18B0, 0x18F5, WORD_CHARACTER_LETTER},
+  {0x1900, 0x191E, WORD_CHARACTER_LETTER},
+  {0x1920, 0x192B, WORD_CHARACTER_EXTEND},
+  {0x1930, 0x193B, WORD_CHARACTER_EXTEND},
+  {0x1940, 0x1940, WORD_CHARACTER_SEPARATOR},
+  {0x1944, 0x1945, WORD_CHARACTER_SEPARATOR},
+  {0x1950, 0x196D, WORD_CHARACTER_LETTER},
+  {0x1970, 0x1974, WORD_CHARACTER_LETTER},
+  {0x1980, 0x19AB, WORD_CHARACTER_LETTER},
+  {0x19B0, 0x19C9, WORD_CHARACTER_LETTER},
+  {0x19DA, 0x19DA, WORD_CHARACTER_SEPARATOR},
+  {0x19DE, 0x19FF, WORD_CHARACTER_SEPARATOR},
+  {0x1A00, 0x1A16, WORD_CHARACTER_LETTER},
+  {0x1A17, 0x1A1B, WORD_CHARACTER_EXTEND},
+  {0x1A1E, 0x1A1F, WORD_CHARACTER_SEPARATOR},
+  {0x1A20, 0x1A54, WORD_CHARACTER_LETTER},
+  {0x1A55, 0x1A5E, WORD_CHARACTER_EXTEND},
+  {0x1A60, 0x1A7C, WORD_CHARACTER_EXTEND},
+  {0x1A7F, 0x1A7F, WORD_CHARACTER_EXTEND},
+  {0x1AA0, 0x1AA6, WORD_CHARACTER_SEPARATOR},
+  {0x1AA7, 0x1AA7, WORD_CHARACTER_LETTER},
+  {0x1AA8, 0x1AAD, WORD_CHARACTER_SEPARATOR},
+  {0x1AB0, 0x1ACE, WORD_CHARACTER_EXTEND},
+  {0x1B00, 0x1B04, WORD_CHARACTER_EXTEND},
+  {0x1B05, 0x1B33, WORD_CHARACTER_LETTER},
+  {0x1B34, 0x1B44, WORD_CHARACTER_EXTEND},
+  {0x1B45, 0x1B4C, WORD_CHARACTER_LETTER},
+  {0x1B5A, 0x1B6A, WORD_CHARACTER_SEPARATOR},
+  {0x1B6B, 0x1B73, WORD_CHARACTER_EXTEND},
+  {0x1B74, 0x1B7E, WORD_CHARACTER_SEPARATOR},
+  {0x1B80, 0x1B82, WORD_CHARACTER_EXTEND},
+  {0x1B83, 0x1BA0, WORD_CHARACTER_LETTER},
+  {0x1BA1, 0x1BAD, WORD_CHARACTER_EXTEND},
+  {0x1BAE, 0x1BAF, WORD_CHARACTER_LETTER},
+  {0x1BBA, 0x1BE5, WORD_CHARACTER_LETTER},
+  {0x1BE6, 0x1BF3, WORD_CHARACTER_EXTEND},
+  {0x1BFC, 0x1BFF, WORD_CHARACTER_SEPARATOR},
+  {0x1C00, 0x1C23, WORD_CHARACTER_LETTER},
+  {0x1C24, 0x1C37, WORD_CHARACTER_EXTEND},
+  {0x1C3B, 0x1C3F, WORD_CHARACTER_SEPARATOR},
+  {0x1C4D, 0x1C4F, WORD_CHARACTER_LETTER},
+  {0x1C5A, 0x1C7D, WORD_CHARACTER_LETTER},
+  {0x1C7E, 0x1C7F, WORD_CHARACTER_SEPARATOR},
+  {0x1C80, 0x1C88, WORD_CHARACTER_LETTER},
+  {0x1C90, 0x1CBA, WORD_CHARACTER_LETTER},
+  {0x1CBD, 0x1CBF, WORD_CHARACTER_LETTER},
+  {0x1CC0, 0x1CC7, WORD_CHARACTER_SEPARATOR},
+  {0x1CD0, 0x1CD2, WORD_CHARACTER_EXTEND},
+  {0x1CD3, 0x1CD3, WORD_CHARACTER_SEPARATOR},
+  {0x1CD4, 0x1CE8, WORD_CHARACTER_EXTEND},
+  {0x1CE9, 0x1CEC, WORD_CHARACTER_LETTER},
+  {0x1CED, 0x1CED, WORD_CHARACTER_EXTEND},
+  {0x1CEE, 0x1CF3, WORD_CHARACTER_LETTER},
+  {0x1CF4, 0x1CF4, WORD_CHARACTER_EXTEND},
+  {0x1CF5, 0x1CF6, WORD_CHARACTER_LETTER},
+  {0x1CF7, 0x1CF9, WORD_CHARACTER_EXTEND},
+  {0x1CFA, 0x1CFA, WORD_CHARACTER_LETTER},
+  {0x1D00, 0x1DBF, WORD_CHARACTER_LETTER},
+  {0x1DC0, 0x1DFF, WORD_CHARACTER_EXTEND},
+  {0x1E00, 0x1F15, WORD_CHARACTER_LETTER},
+  {0x1F18, 0x1F1D, WORD_CHARACTER_LETTER},
+  {0x1F20, 0x1F45, WORD_CHARACTER_LETTER},
+  {0x1F48, 0x1F4D, WORD_CHARACTER_LETTER},
+  {0x1F50, 0x1F57, WORD_CHARACTER_LETTER},
+  {0x1F59, 0x1F59, WORD_CHARACTER_LETTER},
+  {0x1F5B, 0x1F5B, WORD_CHARACTER_LETTER},
+  {0x1F5D, 0x1F5D, WORD_CHARACTER_LETTER},
+  {0x1F5F, 0x1F7D, WORD_CHARACTER_LETTER},
+  {0x1F80, 0x1FB4, WORD_CHARACTER_LETTER},
+  {0x1FB6, 0x1FBC, WORD_CHARACTER_LETTER},
+  {0x1FBD, 0x1FBD, WORD_CHARACTER_SEPARATOR},
+  {0x1FBE, 0x1FBE, WORD_CHARACTER_LETTER},
+  {0x1FBF, 0x1FC1, WORD_CHARACTER_SEPARATOR},
+  {0x1FC2, 0x1FC4, WORD_CHARACTER_LETTER},
+  {0x1FC6, 0x1FCC, WORD_CHARACTER_LETTER},
+  {0x1FCD, 0x1FCF, WORD_CHARACTER_SEPARATOR},
+  {0x1FD0, 0x1FD3, WORD_CHARACTER_LETTER},
+  {0x1FD6, 0x1FDB, WORD_CHARACTER_LETTER},
+  {0x1FDD, 0x1FDF, WORD_CHARACTER_SEPARATOR},
+  {0x1FE0, 0x1FEC, WORD_CHARACTER_LETTER},
+  {0x1FED, 0x1FEF, WORD_CHARACTER_SEPARATOR},
+  {0x1FF2, 0x1FF4, WORD_CHARACTER_LETTER},
+  {0x1FF6, 0x1FFC, WORD_CHARACTER_LETTER},
+  {0x1FFD, 0x1FFE, WORD_CHARACTER_SEPARATOR},
+  {0x2000, 0x200B, WORD_CHARACTER_SEPARATOR},
+  {0x200C, 0x200F, WORD_CHARACTER_EXTEND},
+  {0x2010, 0x2029, WORD_CHARACTER_SEPARATOR},
+  {0x202A, 0x202E, WORD_CHARACTER_EXTEND},
+  {0x202F, 0x205F, WORD_CHARACTER_SEPARATOR},
+  {0x2060, 0x2064, WORD_CHARACTER_EXTEND},
+  {0x2066, 0x206F, WORD_CHARACTER_EXTEND},
+  {0x2070, 0x2070, WORD_CHARACTER_SEPARATOR},
+  {0x2071, 0x2071, WORD_CHARACTER_LETTER},
+  {0x2074, 0x207E, WORD_CHARACTER_SEPARATOR},
+  {0x207F, 0x207F, WORD_CHARACTER_LETTER},
+  {0x2080, 0x208E, WORD_CHARACTER_SEPARATOR},
+  {0x2090, 0x209C, WORD_CHARACTER_LETTER},
+  {0x20A0, 0x20C0, WORD_CHARACTER_SEPARATOR},
+  {0x20D0, 0x20F0, WORD_CHARACTER_EXTEND},
+  {0x2100, 0x2101, WORD_CHARACTER_SEPARATOR},
+  {0x2102, 0x2102, WORD_CHARACTER_LETTER},
+  {0x2103, 0x2106, WORD_CHARACTER_SEPARATOR},
+  {0x2107, 0x2107, WORD_CHARACTER_LETTER},
+  {0x2108, 0x2109, WORD_CHARACTER_SEPARATOR},
+  {0x210A, 0x2113, WORD_CHARACTER_LETTER},
+  {0x2114, 0x2114, WORD_CHARACTER_SEPARATOR},
+  {0x2115, 0x2115, WORD_CHARACTER_LETTER},
+  {0x2116, 0x2118, WORD_CHARACTER_SEPARATOR},
+  {0x2119, 0x211D, WORD_CHARACTER_LETTER},
+  {0x211E, 0x2123, WORD_CHARACTER_SEPARATOR},
+  {0x2124, 0x2124, WORD_CHARACTER_LETTER},
+  {0x2125, 0x2125, WORD_CHARACTER_SEPARATOR},
+  {0x2126, 0x2126, WORD_CHARACTER_LETTER},
+  {0x2127, 0x2127, WORD_CHARACTER_SEPARATOR},
+  {0x2128, 0x2128, WORD_CHARACTER_LETTER},
+  {0x2129, 0x2129, WORD_CHARACTER_SEPARATOR},
+  {0x212A, 0x212D, WORD_CHARACTER_LETTER},
+  {0x212E, 0x212E, WORD_CHARACTER_SEPARATOR},
+  {0x212F, 0x2139, WORD_CHARACTER_LETTER},
+  {0x213A, 0x213B, WORD_CHARACTER_SEPARATOR},
+  {0x213C, 0x213F, WORD_CHARACTER_LETTER},
+  {0x2140, 0x2144, WORD_CHARACTER_SEPARATOR},
+  {0x2145, 0x2149, WORD_CHARACTER_LETTER},
+  {0x214A, 0x214D, WORD_CHARACTER_SEPARATOR},
+  {0x214E, 0x214E, WORD_CHARACTER_LETTER},
+  {0x214F, 0x215F, WORD_CHARACTER_SEPARATOR},
+  {0x2160, 0x2188, WORD_CHARACTER_LETTER},
+  {0x2189, 0x218B, WORD_CHARACTER_SEPARATOR},
+  {0x2190, 0x2426, WORD_CHARACTER_SEPARATOR},
+  {0x2440, 0x244A, WORD_CHARACTER_SEPARATOR},
+  {0x2460, 0x2B73, WORD_CHARACTER_SEPARATOR},
+  {0x2B76, 0x2B95, WORD_CHARACTER_SEPARATOR},
+  {0x2B97, 0x2BFF, WORD_CHARACTER_SEPARATOR},
+  {0x2C00, 0x2CE4, WORD_CHARACTER_LETTER},
+  {0x2CE5, 0x2CEA, WORD_CHARACTER_SEPARATOR},
+  {0x2CEB, 0x2CEE, WORD_CHARACTER_LETTER},
+  {0x2CEF, 0x2CF1, WORD_CHARACTER_EXTEND},
+  {0x2CF2, 0x2CF3, WORD_CHARACTER_LETTER},
+  {0x2CF9, 0x2CFF, WORD_CHARACTER_SEPARATOR},
+  {0x2D00, 0x2D25, WORD_CHARACTER_LETTER},
+  {0x2D27, 0x2D27, WORD_CHARACTER_LETTER},
+  {0x2D2D, 0x2D2D, WORD_CHARACTER_LETTER},
+  {0x2D30, 0x2D67, WORD_CHARACTER_LETTER},
+  {0x2D6F, 0x2D6F, WORD_CHARACTER_LETTER},
+  {0x2D70, 0x2D70, WORD_CHARACTER_SEPARATOR},
+  {0x2D7F, 0x2D7F, WORD_CHARACTER_EXTEND},
+  {0x2D80, 0x2D96, WORD_CHARACTER_LETTER},
+  {0x2DA0, 0x2DA6, WORD_CHARACTER_LETTER},
+  {0x2DA8, 0x2DAE, WORD_CHARACTER_LETTER},
+  {0x2DB0, 0x2DB6, WORD_CHARACTER_LETTER},
+  {0x2DB8, 0x2DBE, WORD_CHARACTER_LETTER},
+  {0x2DC0, 0x2DC6, WORD_CHARACTER_LETTER},
+  {0x2DC8, 0x2DCE, WORD_CHARACTER_LETTER},
+  {0x2DD0, 0x2DD6, WORD_CHARACTER_LETTER},
+  {0x2DD8, 0x2DDE, WORD_CHARACTER_LETTER},
+  {0x2DE0, 0x2DFF, WORD_CHARACTER_EXTEND},
+  {0x2E00, 0x2E2E, WORD_CHARACTER_SEPARATOR},
+  {0x2E2F, 0x2E2F, WORD_CHARACTER_LETTER},
+  {0x2E30, 0x2E5D, WORD_CHARACTER_SEPARATOR},
+  {0x2E80, 0x2E99, WORD_CHARACTER_SEPARATOR},
+  {0x2E9B, 0x2EF3, WORD_CHARACTER_SEPARATOR},
+  {0x2F00, 0x2FD5, WORD_CHARACTER_SEPARATOR},
+  {0x2FF0, 0x2FFB, WORD_CHARACTER_SEPARATOR},
+  {0x3000, 0x3004, WORD_CHARACTER_SEPARATOR},
+  {0x3005, 0x3007, WORD_CHARACTER_LETTER},
+  {0x3008, 0x3020, WORD_CHARACTER_SEPARATOR},
+  {0x3021, 0x3029, WORD_CHARACTER_LETTER},
+  {0x302A, 0x302F, WORD_CHARACTER_EXTEND},
+  {0x3030, 0x3030, WORD_CHARACTER_SEPARATOR},
+  {0x3031, 0x3035, WORD_CHARACTER_LETTER},
+  {0x3036, 0x3037, WORD_CHARACTER_SEPARATOR},
+  {0x3038, 0x303C, WORD_CHARACTER_LETTER},
+  {0x303D, 0x303F, WORD_CHARACTER_SEPARATOR},
+  {0x3041, 0x3096, WORD_CHARACTER_LETTER},
+  {0x3099, 0x309A, WORD_CHARACTER_EXTEND},
+  {0x309B, 0x309C, WORD_CHARACTER_SEPARATOR},
+  {0x309D, 0x309F, WORD_CHARACTER_LETTER},
+  {0x30A0, 0x30A0, WORD_CHARACTER_SEPARATOR},
+  {0x30A1, 0x30FA, WORD_CHARACTER_LETTER},
+  {0x30FB, 0x30FB, WORD_CHARACTER_SEPARATOR},
+  {0x30FC, 0x30FF, WORD_CHARACTER_LETTER},
+  {0x3105, 0x312F, WORD_CHARACTER_LETTER},
+  {0x3131, 0x318E, WORD_CHARACTER_LETTER},
+  {0x3190, 0x319F, WORD_CHARACTER_SEPARATOR},
+  {0x31A0, 0x31BF, WORD_CHARACTER_LETTER},
+  {0x31C0, 0x31E3, WORD_CHARACTER_SEPARATOR},
+  {0x31F0, 0x31FF, WORD_CHARACTER_LETTER},
+  {0x3200, 0x321E, WORD_CHARACTER_SEPARATOR},
+  {0x3220, 0x33FF, WORD_CHARACTER_SEPARATOR},
+  {0x3400, 0x4DBF, WORD_CHARACTER_LETTER},
+  {0x4DC0, 0x4DFF, WORD_CHARACTER_SEPARATOR},
+  {0x4E00, 0xA48C, WORD_CHARACTER_LETTER},
+  {0xA490, 0xA4C6, WORD_CHARACTER_SEPARATOR},
+  {0xA4D0, 0xA4FD, WORD_CHARACTER_LETTER},
+  {0xA4FE, 0xA4FF, WORD_CHARACTER_SEPARATOR},
+  {0xA500, 0xA60C, WORD_CHARACTER_LETTER},
+  {0xA60D, 0xA60F, WORD_CHARACTER_SEPARATOR},
+  {0xA610, 0xA61F, WORD_CHARACTER_LETTER},
+  {0xA62A, 0xA62B, WORD_CHARACTER_LETTER},
+  {0xA640, 0xA66E, WORD_CHARACTER_LETTER},
+  {0xA66F, 0xA672, WORD_CHARACTER_EXTEND},
+  {0xA673, 0xA673, WORD_CHARACTER_SEPARATOR},
+  {0xA674, 0xA67D, WORD_CHARACTER_EXTEND},
+  {0xA67E, 0xA67E, WORD_CHARACTER_SEPARATOR},
+  {0xA67F, 0xA69D, WORD_CHARACTER_LETTER},
+  {0xA69E, 0xA69F, WORD_CHARACTER_EXTEND},
+  {0xA6A0, 0xA6EF, WORD_CHARACTER_LETTER},
+  {0xA6F0, 0xA6F1, WORD_CHARACTER_EXTEND},
+  {0xA6F2, 0xA6F7, WORD_CHARACTER_SEPARATOR},
+  {0xA700, 0xA716, WORD_CHARACTER_SEPARATOR},
+  {0xA717, 0xA71F, WORD_CHARACTER_LETTER},
+  {0xA720, 0xA721, WORD_CHARACTER_SEPARATOR},
+  {0xA722, 0xA788, WORD_CHARACTER_LETTER},
+  {0xA789, 0xA78A, WORD_CHARACTER_SEPARATOR},
+  {0xA78B, 0xA7CA, WORD_CHARACTER_LETTER},
+  {0xA7D0, 0xA7D1, WORD_CHARACTER_LETTER},
+  {0xA7D3, 0xA7D3, WORD_CHARACTER_LETTER},
+  {0xA7D5, 0xA7D9, WORD_CHARACTER_LETTER},
+  {0xA7F2, 0xA801, WORD_CHARACTER_LETTER},
+  {0xA802, 0xA802, WORD_CHARACTER_EXTEND},
+  {0xA803, 0xA805, WORD_CHARACTER_LETTER},
+  {0xA806, 0xA806, WORD_CHARACTER_EXTEND},
+  {0xA807, 0xA80A, WORD_CHARACTER_LETTER},
+  {0xA80B, 0xA80B, WORD_CHARACTER_EXTEND},
+  {0xA80C, 0xA822, WORD_CHARACTER_LETTER},
+  {0xA823, 0xA827, WORD_CHARACTER_EXTEND},
+  {0xA828, 0xA82B, WORD_CHARACTER_SEPARATOR},
+  {0xA82C, 0xA82C, WORD_CHARACTER_EXTEND},
+  {0xA830, 0xA839, WORD_CHARACTER_SEPARATOR},
+  {0xA840, 0xA873, WORD_CHARACTER_LETTER},
+  {0xA874, 0xA877, WORD_CHARACTER_SEPARATOR},
+  {0xA880, 0xA881, WORD_CHARACTER_EXTEND},
+  {0xA882, 0xA8B3, WORD_CHARACTER_LETTER},
+  {0xA8B4, 0xA8C5, WORD_CHARACTER_EXTEND},
+  {0xA8CE, 0xA8CF, WORD_CHARACTER_SEPARATOR},
+  {0xA8E0, 0xA8F1, WORD_CHARACTER_EXTEND},
+  {0xA8F2, 0xA8F7, WORD_CHARACTER_LETTER},
+  {0xA8F8, 0xA8FA, WORD_CHARACTER_SEPARATOR},
+  {0xA8FB, 0xA8FB, WORD_CHARACTER_LETTER},
+  {0xA8FC, 0xA8FC, WORD_CHARACTER_SEPARATOR},
+  {0xA8FD, 0xA8FE, WORD_CHARACTER_LETTER},
+  {0xA8FF, 0xA8FF, WORD_CHARACTER_EXTEND},
+  {0xA90A, 0xA925, WORD_CHARACTER_LETTER},
+  {0xA926, 0xA92D, WORD_CHARACTER_EXTEND},
+  {0xA92E, 0xA92F, WORD_CHARACTER_SEPARATOR},
+  {0xA930, 0xA946, WORD_CHARACTER_LETTER},
+  {0xA947, 0xA953, WORD_CHARACTER_EXTEND},
+  {0xA95F, 0xA95F, WORD_CHARACTER_SEPARATOR},
+  {0xA960, 0xA97C, WORD_CHARACTER_LETTER},
+  {0xA980, 0xA983, WORD_CHARACTER_EXTEND},
+  {0xA984, 0xA9B2, WORD_CHARACTER_LETTER},
+  {0xA9B3, 0xA9C0, WORD_CHARACTER_EXTEND},
+  {0xA9C1, 0xA9CD, WORD_CHARACTER_SEPARATOR},
+  {0xA9CF, 0xA9CF, WORD_CHARACTER_LETTER},
+  {0xA9DE, 0xA9DF, WORD_CHARACTER_SEPARATOR},
+  {0xA9E0, 0xA9E4, WORD_CHARACTER_LETTER},
+  {0xA9E5, 0xA9E5, WORD_CHARACTER_EXTEND},
+  {0xA9E6, 0xA9EF, WORD_CHARACTER_LETTER},
+  {0xA9FA, 0xA9FE, WORD_CHARACTER_LETTER},
+  {0xAA00, 0xAA28, WORD_CHARACTER_LETTER},
+  {0xAA29, 0xAA36, WORD_CHARACTER_EXTEND},
+  {0xAA40, 0xAA42, WORD_CHARACTER_LETTER},
+  {0xAA43, 0xAA43, WORD_CHARACTER_EXTEND},
+  {0xAA44, 0xAA4B, WORD_CHARACTER_LETTER},
+  {0xAA4C, 0xAA4D, WORD_CHARACTER_EXTEND},
+  {0xAA5C, 0xAA5F, WORD_CHARACTER_SEPARATOR},
+  {0xAA60, 0xAA76, WORD_CHARACTER_LETTER},
+  {0xAA77, 0xAA79, WORD_CHARACTER_SEPARATOR},
+  {0xAA7A, 0xAA7A, WORD_CHARACTER_LETTER},
+  {0xAA7B, 0xAA7D, WORD_CHARACTER_EXTEND},
+  {0xAA7E, 0xAAAF, WORD_CHARACTER_LETTER},
+  {0xAAB0, 0xAAB0, WORD_CHARACTER_EXTEND},
+  {0xAAB1, 0xAAB1, WORD_CHARACTER_LETTER},
+  {0xAAB2, 0xAAB4, WORD_CHARACTER_EXTEND},
+  {0xAAB5, 0xAAB6, WORD_CHARACTER_LETTER},
+  {0xAAB7, 0xAAB8, WORD_CHARACTER_EXTEND},
+  {0xAAB9, 0xAABD, WORD_CHARACTER_LETTER},
+  {0xAABE, 0xAABF, WORD_CHARACTER_EXTEND},
+  {0xAAC0, 0xAAC0, WORD_CHARACTER_LETTER},
+  {0xAAC1, 0xAAC1, WORD_CHARACTER_EXTEND},
+  {0xAAC2, 0xAAC2, WORD_CHARACTER_LETTER},
+  {0xAADB, 0xAADD, WORD_CHARACTER_LETTER},
+  {0xAADE, 0xAADF, WORD_CHARACTER_SEPARATOR},
+  {0xAAE0, 0xAAEA, WORD_CHARACTER_LETTER},
+  {0xAAEB, 0xAAEF, WORD_CHARACTER_EXTEND},
+  {0xAAF0, 0xAAF1, WORD_CHARACTER_SEPARATOR},
+  {0xAAF2, 0xAAF4, WORD_CHARACTER_LETTER},
+  {0xAAF5, 0xAAF6, WORD_CHARACTER_EXTEND},
+  {0xAB01, 0xAB06, WORD_CHARACTER_LETTER},
+  {0xAB09, 0xAB0E, WORD_CHARACTER_LETTER},
+  {0xAB11, 0xAB16, WORD_CHARACTER_LETTER},
+  {0xAB20, 0xAB26, WORD_CHARACTER_LETTER},
+  {0xAB28, 0xAB2E, WORD_CHARACTER_LETTER},
+  {0xAB30, 0xAB5A, WORD_CHARACTER_LETTER},
+  {0xAB5B, 0xAB5B, WORD_CHARACTER_SEPARATOR},
+  {0xAB5C, 0xAB69, WORD_CHARACTER_LETTER},
+  {0xAB6A, 0xAB6B, WORD_CHARACTER_SEPARATOR},
+  {0xAB70, 0xABE2, WORD_CHARACTER_LETTER},
+  {0xABE3, 0xABEA, WORD_CHARACTER_EXTEND},
+  {0xABEB, 0xABEB, WORD_CHARACTER_SEPARATOR},
+  {0xABEC, 0xABED, WORD_CHARACTER_EXTEND},
+  {0xAC00, 0xD7A3, WORD_CHARACTER_LETTER},
+  {0xD7B0, 0xD7C6, WORD_CHARACTER_LETTER},
+  {0xD7CB, 0xD7FB, WORD_CHARACTER_LETTER},
+  {0xE000, 0xF8FF, WORD_CHARACTER_SEPARATOR},
+  {0xF900, 0xFA6D, WORD_CHARACTER_LETTER},
+  {0xFA70, 0xFAD9, WORD_CHARACTER_LETTER},
+  {0xFB00, 0xFB06, WORD_CHARACTER_LETTER},
+  {0xFB13, 0xFB17, WORD_CHARACTER_LETTER},
+  {0xFB1D, 0xFB1D, WORD_CHARACTER_LETTER},
+  {0xFB1E, 0xFB1E, WORD_CHARACTER_EXTEND},
+  {0xFB1F, 0xFB28, WORD_CHARACTER_LETTER},
+  {0xFB29, 0xFB29, WORD_CHARACTER_SEPARATOR},
+  {0xFB2A, 0xFB36, WORD_CHARACTER_LETTER},
+  {0xFB38, 0xFB3C, WORD_CHARACTER_LETTER},
+  {0xFB3E, 0xFB3E, WORD_CHARACTER_LETTER},
+  {0xFB40, 0xFB41, WORD_CHARACTER_LETTER},
+  {0xFB43, 0xFB44, WORD_CHARACTER_LETTER},
+  {0xFB46, 0xFBB1, WORD_CHARACTER_LETTER},
+  {0xFBB2, 0xFBC2, WORD_CHARACTER_SEPARATOR},
+  {0xFBD3, 0xFD3D, WORD_CHARACTER_LETTER},
+  {0xFD3E, 0xFD4F, WORD_CHARACTER_SEPARATOR},
+  {0xFD50, 0xFD8F, WORD_CHARACTER_LETTER},
+  {0xFD92, 0xFDC7, WORD_CHARACTER_LETTER},
+  {0xFDCF, 0xFDCF, WORD_CHARACTER_SEPARATOR},
+  {0xFDF0, 0xFDFB, WORD_CHARACTER_LETTER},
+  {0xFDFC, 0xFDFF, WORD_CHARACTER_SEPARATOR},
+  {0xFE00, 0xFE0F, WORD_CHARACTER_EXTEND},
+  {0xFE10, 0xFE19, WORD_CHARACTER_SEPARATOR},
+  {0xFE20, 0xFE2F, WORD_CHARACTER_EXTEND},
+  {0xFE30, 0xFE52, WORD_CHARACTER_SEPARATOR},
+  {0xFE54, 0xFE66, WORD_CHARACTER_SEPARATOR},
+  {0xFE68, 0xFE6B, WORD_CHARACTER_SEPARATOR},
+  {0xFE70, 0xFE74, WORD_CHARACTER_LETTER},
+  {0xFE76, 0xFEFC, WORD_CHARACTER_LETTER},
+  {0xFEFF, 0xFEFF, WORD_CHARACTER_EXTEND},
+  {0xFF01, 0xFF0F, WORD_CHARACTER_SEPARATOR},
+  {0xFF1A, 0xFF20, WORD_CHARACTER_SEPARATOR},
+  {0xFF21, 0xFF3A, WORD_CHARACTER_LETTER},
+  {0xFF3B, 0xFF40, WORD_CHARACTER_SEPARATOR},
+  {0xFF41, 0xFF5A, WORD_CHARACTER_LETTER},
+  {0xFF5B, 0xFF65, WORD_CHARACTER_SEPARATOR},
+  {0xFF66, 0xFFBE, WORD_CHARACTER_LETTER},
+  {0xFFC2, 0xFFC7, WORD_CHARACTER_LETTER},
+  {0xFFCA, 0xFFCF, WORD_CHARACTER_LETTER},
+  {0xFFD2, 0xFFD7, WORD_CHARACTER_LETTER},
+  {0xFFDA, 0xFFDC, WORD_CHARACTER_LETTER},
+  {0xFFE0, 0xFFE6, WORD_CHARACTER_SEPARATOR},
+  {0xFFE8, 0xFFEE, WORD_CHARACTER_SEPARATOR},
+  {0xFFF9, 0xFFFB, WORD_CHARACTER_EXTEND},
+  {0xFFFC, 0xFFFD, WORD_CHARACTER_SEPARATOR},
+  {0x10000, 0x1000B, WORD_CHARACTER_LETTER},
+  {0x1000D, 0x10026, WORD_CHARACTER_LETTER},
+  {0x10028, 0x1003A, WORD_CHARACTER_LETTER},
+  {0x1003C, 0x1003D, WORD_CHARACTER_LETTER},
+  {0x1003F, 0x1004D, WORD_CHARACTER_LETTER},
+  {0x10050, 0x1005D, WORD_CHARACTER_LETTER},
+  {0x10080, 0x100FA, WORD_CHARACTER_LETTER},
+  {0x10100, 0x10102, WORD_CHARACTER_SEPARATOR},
+  {0x10107, 0x10133, WORD_CHARACTER_SEPARATOR},
+  {0x10137, 0x1013F, WORD_CHARACTER_SEPARATOR},
+  {0x10140, 0x10174, WORD_CHARACTER_LETTER},
+  {0x10175, 0x1018E, WORD_CHARACTER_SEPARATOR},
+  {0x10190, 0x1019C, WORD_CHARACTER_SEPARATOR},
+  {0x101A0, 0x101A0, WORD_CHARACTER_SEPARATOR},
+  {0x101D0, 0x101FC, WORD_CHARACTER_SEPARATOR},
+  {0x101FD, 0x101FD, WORD_CHARACTER_EXTEND},
+  {0x10280, 0x1029C, WORD_CHARACTER_LETTER},
+  {0x102A0, 0x102D0, WORD_CHARACTER_LETTER},
+  {0x102E0, 0x102E0, WORD_CHARACTER_EXTEND},
+  {0x102E1, 0x102FB, WORD_CHARACTER_SEPARATOR},
+  {0x10300, 0x1031F, WORD_CHARACTER_LETTER},
+  {0x10320, 0x10323, WORD_CHARACTER_SEPARATOR},
+  {0x1032D, 0x1034A, WORD_CHARACTER_LETTER},
+  {0x10350, 0x10375, WORD_CHARACTER_LETTER},
+  {0x10376, 0x1037A, WORD_CHARACTER_EXTEND},
+  {0x10380, 0x1039D, WORD_CHARACTER_LETTER},
+  {0x1039F, 0x1039F, WORD_CHARACTER_SEPARATOR},
+  {0x103A0, 0x103C3, WORD_CHARACTER_LETTER},
+  {0x103C8, 0x103CF, WORD_CHARACTER_LETTER},
+  {0x103D0, 0x103D0, WORD_CHARACTER_SEPARATOR},
+  {0x103D1, 0x103D5, WORD_CHARACTER_LETTER},
+  {0x10400, 0x1049D, WORD_CHARACTER_LETTER},
+  {0x104B0, 0x104D3, WORD_CHARACTER_LETTER},
+  {0x104D8, 0x104FB, WORD_CHARACTER_LETTER},
+  {0x10500, 0x10527, WORD_CHARACTER_LETTER},
+  {0x10530, 0x10563, WORD_CHARACTER_LETTER},
+  {0x1056F, 0x1056F, WORD_CHARACTER_SEPARATOR},
+  {0x10570, 0x1057A, WORD_CHARACTER_LETTER},
+  {0x1057C, 0x1058A, WORD_CHARACTER_LETTER},
+  {0x1058C, 0x10592, WORD_CHARACTER_LETTER},
+  {0x10594, 0x10595, WORD_CHARACTER_LETTER},
+  {0x10597, 0x105A1, WORD_CHARACTER_LETTER},
+  {0x105A3, 0x105B1, WORD_CHARACTER_LETTER},
+  {0x105B3, 0x105B9, WORD_CHARACTER_LETTER},
+  {0x105BB, 0x105BC, WORD_CHARACTER_LETTER},
+  {0x10600, 0x10736, WORD_CHARACTER_LETTER},
+  {0x10740, 0x10755, WORD_CHARACTER_LETTER},
+  {0x10760, 0x10767, WORD_CHARACTER_LETTER},
+  {0x10780, 0x10785, WORD_CHARACTER_LETTER},
+  {0x10787, 0x107B0, WORD_CHARACTER_LETTER},
+  {0x107B2, 0x107BA, WORD_CHARACTER_LETTER},
+  {0x10800, 0x10805, WORD_CHARACTER_LETTER},
+  {0x10808, 0x10808, WORD_CHARACTER_LETTER},
+  {0x1080A, 0x10835, WORD_CHARACTER_LETTER},
+  {0x10837, 0x10838, WORD_CHARACTER_LETTER},
+  {0x1083C, 0x1083C, WORD_CHARACTER_LETTER},
+  {0x1083F, 0x10855, WORD_CHARACTER_LETTER},
+  {0x10857, 0x1085F, WORD_CHARACTER_SEPARATOR},
+  {0x10860, 0x10876, WORD_CHARACTER_LETTER},
+  {0x10877, 0x1087F, WORD_CHARACTER_SEPARATOR},
+  {0x10880, 0x1089E, WORD_CHARACTER_LETTER},
+  {0x108A7, 0x108AF, WORD_CHARACTER_SEPARATOR},
+  {0x108E0, 0x108F2, WORD_CHARACTER_LETTER},
+  {0x108F4, 0x108F5, WORD_CHARACTER_LETTER},
+  {0x108FB, 0x108FF, WORD_CHARACTER_SEPARATOR},
+  {0x10900, 0x10915, WORD_CHARACTER_LETTER},
+  {0x10916, 0x1091B, WORD_CHARACTER_SEPARATOR},
+  {0x1091F, 0x1091F, WORD_CHARACTER_SEPARATOR},
+  {0x10920, 0x10939, WORD_CHARACTER_LETTER},
+  {0x1093F, 0x1093F, WORD_CHARACTER_SEPARATOR},
+  {0x10980, 0x109B7, WORD_CHARACTER_LETTER},
+  {0x109BC, 0x109BD, WORD_CHARACTER_SEPARATOR},
+  {0x109BE, 0x109BF, WORD_CHARACTER_LETTER},
+  {0x109C0, 0x109CF, WORD_CHARACTER_SEPARATOR},
+  {0x109D2, 0x109FF, WORD_CHARACTER_SEPARATOR},
+  {0x10A00, 0x10A00, WORD_CHARACTER_LETTER},
+  {0x10A01, 0x10A03, WORD_CHARACTER_EXTEND},
+  {0x10A05, 0x10A06, WORD_CHARACTER_EXTEND},
+  {0x10A0C, 0x10A0F, WORD_CHARACTER_EXTEND},
+  {0x10A10, 0x10A13, WORD_CHARACTER_LETTER},
+  {0x10A15, 0x10A17, WORD_CHARACTER_LETTER},
+  {0x10A19, 0x10A35, WORD_CHARACTER_LETTER},
+  {0x10A38, 0x10A3A, WORD_CHARACTER_EXTEND},
+  {0x10A3F, 0x10A3F, WORD_CHARACTER_EXTEND},
+  {0x10A40, 0x10A48, WORD_CHARACTER_SEPARATOR},
+  {0x10A50, 0x10A58, WORD_CHARACTER_SEPARATOR},
+  {0x10A60, 0x10A7C, WORD_CHARACTER_LETTER},
+  {0x10A7D, 0x10A7F, WORD_CHARACTER_SEPARATOR},
+  {0x10A80, 0x10A9C, WORD_CHARACTER_LETTER},
+  {0x10A9D, 0x10A9F, WORD_CHARACTER_SEPARATOR},
+  {0x10AC0, 0x10AC7, WORD_CHARACTER_LETTER},
+  {0x10AC8, 0x10AC8, WORD_CHARACTER_SEPARATOR},
+  {0x10AC9, 0x10AE4, WORD_CHARACTER_LETTER},
+  {0x10AE5, 0x10AE6, WORD_CHARACTER_EXTEND},
+  {0x10AEB, 0x10AF6, WORD_CHARACTER_SEPARATOR},
+  {0x10B00, 0x10B35, WORD_CHARACTER_LETTER},
+  {0x10B39, 0x10B3F, WORD_CHARACTER_SEPARATOR},
+  {0x10B40, 0x10B55, WORD_CHARACTER_LETTER},
+  {0x10B58, 0x10B5F, WORD_CHARACTER_SEPARATOR},
+  {0x10B60, 0x10B72, WORD_CHARACTER_LETTER},
+  {0x10B78, 0x10B7F, WORD_CHARACTER_SEPARATOR},
+  {0x10B80, 0x10B91, WORD_CHARACTER_LETTER},
+  {0x10B99, 0x10B9C, WORD_CHARACTER_SEPARATOR},
+  {0x10BA9, 0x10BAF, WORD_CHARACTER_SEPARATOR},
+  {0x10C00, 0x10C48, WORD_CHARACTER_LETTER},
+  {0x10C80, 0x10CB2, WORD_CHARACTER_LETTER},
+  {0x10CC0, 0x10CF2, WORD_CHARACTER_LETTER},
+  {0x10CFA, 0x10CFF, WORD_CHARACTER_SEPARATOR},
+  {0x10D00, 0x10D23, WORD_CHARACTER_LETTER},
+  {0x10D24, 0x10D27, WORD_CHARACTER_EXTEND},
+  {0x10E60, 0x10E7E, WORD_CHARACTER_SEPARATOR},
+  {0x10E80, 0x10EA9, WORD_CHARACTER_LETTER},
+  {0x10EAB, 0x10EAC, WORD_CHARACTER_EXTEND},
+  {0x10EAD, 0x10EAD, WORD_CHARACTER_SEPARATOR},
+  {0x10EB0, 0x10EB1, WORD_CHARACTER_LETTER},
+  {0x10F00, 0x10F1C, WORD_CHARACTER_LETTER},
+  {0x10F1D, 0x10F26, WORD_CHARACTER_SEPARATOR},
+  {0x10F27, 0x10F27, WORD_CHARACTER_LETTER},
+  {0x10F30, 0x10F45, WORD_CHARACTER_LETTER},
+  {0x10F46, 0x10F50, WORD_CHARACTER_EXTEND},
+  {0x10F51, 0x10F59, WORD_CHARACTER_SEPARATOR},
+  {0x10F70, 0x10F81, WORD_CHARACTER_LETTER},
+  {0x10F82, 0x10F85, WORD_CHARACTER_EXTEND},
+  {0x10F86, 0x10F89, WORD_CHARACTER_SEPARATOR},
+  {0x10FB0, 0x10FC4, WORD_CHARACTER_LETTER},
+  {0x10FC5, 0x10FCB, WORD_CHARACTER_SEPARATOR},
+  {0x10FE0, 0x10FF6, WORD_CHARACTER_LETTER},
+  {0x11000, 0x11002, WORD_CHARACTER_EXTEND},
+  {0x11003, 0x11037, WORD_CHARACTER_LETTER},
+  {0x11038, 0x11046, WORD_CHARACTER_EXTEND},
+  {0x11047, 0x1104D, WORD_CHARACTER_SEPARATOR},
+  {0x11052, 0x11065, WORD_CHARACTER_SEPARATOR},
+  {0x11070, 0x11070, WORD_CHARACTER_EXTEND},
+  {0x11071, 0x11072, WORD_CHARACTER_LETTER},
+  {0x11073, 0x11074, WORD_CHARACTER_EXTEND},
+  {0x11075, 0x11075, WORD_CHARACTER_LETTER},
+  {0x1107F, 0x11082, WORD_CHARACTER_EXTEND},
+  {0x11083, 0x110AF, WORD_CHARACTER_LETTER},
+  {0x110B0, 0x110BA, WORD_CHARACTER_EXTEND},
+  {0x110BB, 0x110BC, WORD_CHARACTER_SEPARATOR},
+  {0x110BD, 0x110BD, WORD_CHARACTER_EXTEND},
+  {0x110BE, 0x110C1, WORD_CHARACTER_SEPARATOR},
+  {0x110C2, 0x110C2, WORD_CHARACTER_EXTEND},
+  {0x110CD, 0x110CD, WORD_CHARACTER_EXTEND},
+  {0x110D0, 0x110E8, WORD_CHARACTER_LETTER},
+  {0x11100, 0x11102, WORD_CHARACTER_EXTEND},
+  {0x11103, 0x11126, WORD_CHARACTER_LETTER},
+  {0x11127, 0x11134, WORD_CHARACTER_EXTEND},
+  {0x11140, 0x11143, WORD_CHARACTER_SEPARATOR},
+  {0x11144, 0x11144, WORD_CHARACTER_LETTER},
+  {0x11145, 0x11146, WORD_CHARACTER_EXTEND},
+  {0x11147, 0x11147, WORD_CHARACTER_LETTER},
+  {0x11150, 0x11172, WORD_CHARACTER_LETTER},
+  {0x11173, 0x11173, WORD_CHARACTER_EXTEND},
+  {0x11174, 0x11175, WORD_CHARACTER_SEPARATOR},
+  {0x11176, 0x11176, WORD_CHARACTER_LETTER},
+  {0x11180, 0x11182, WORD_CHARACTER_EXTEND},
+  {0x11183, 0x111B2, WORD_CHARACTER_LETTER},
+  {0x111B3, 0x111C0, WORD_CHARACTER_EXTEND},
+  {0x111C1, 0x111C4, WORD_CHARACTER_LETTER},
+  {0x111C5, 0x111C8, WORD_CHARACTER_SEPARATOR},
+  {0x111C9, 0x111CC, WORD_CHARACTER_EXTEND},
+  {0x111CD, 0x111CD, WORD_CHARACTER_SEPARATOR},
+  {0x111CE, 0x111CF, WORD_CHARACTER_EXTEND},
+  {0x111DA, 0x111DA, WORD_CHARACTER_LETTER},
+  {0x111DB, 0x111DB, WORD_CHARACTER_SEPARATOR},
+  {0x111DC, 0x111DC, WORD_CHARACTER_LETTER},
+  {0x111DD, 0x111DF, WORD_CHARACTER_SEPARATOR},
+  {0x111E1, 0x111F4, WORD_CHARACTER_SEPARATOR},
+  {0x11200, 0x11211, WORD_CHARACTER_LETTER},
+  {0x11213, 0x1122B, WORD_CHARACTER_LETTER},
+  {0x1122C, 0x11237, WORD_CHARACTER_EXTEND},
+  {0x11238, 0x1123D, WORD_CHARACTER_SEPARATOR},
+  {0x1123E, 0x1123E, WORD_CHARACTER_EXTEND},
+  {0x11280, 0x11286, WORD_CHARACTER_LETTER},
+  {0x11288, 0x11288, WORD_CHARACTER_LETTER},
+  {0x1128A, 0x1128D, WORD_CHARACTER_LETTER},
+  {0x1128F, 0x1129D, WORD_CHARACTER_LETTER},
+  {0x1129F, 0x112A8, WORD_CHARACTER_LETTER},
+  {0x112A9, 0x112A9, WORD_CHARACTER_SEPARATOR},
+  {0x112B0, 0x112DE, WORD_CHARACTER_LETTER},
+  {0x112DF, 0x112EA, WORD_CHARACTER_EXTEND},
+  {0x11300, 0x11303, WORD_CHARACTER_EXTEND},
+  {0x11305, 0x1130C, WORD_CHARACTER_LETTER},
+  {0x1130F, 0x11310, WORD_CHARACTER_LETTER},
+  {0x11313, 0x11328, WORD_CHARACTER_LETTER},
+  {0x1132A, 0x11330, WORD_CHARACTER_LETTER},
+  {0x11332, 0x11333, WORD_CHARACTER_LETTER},
+  {0x11335, 0x11339, WORD_CHARACTER_LETTER},
+  {0x1133B, 0x1133C, WORD_CHARACTER_EXTEND},
+  {0x1133D, 0x1133D, WORD_CHARACTER_LETTER},
+  {0x1133E, 0x11344, WORD_CHARACTER_EXTEND},
+  {0x11347, 0x11348, WORD_CHARACTER_EXTEND},
+  {0x1134B, 0x1134D, WORD_CHARACTER_EXTEND},
+  {0x11350, 0x11350, WORD_CHARACTER_LETTER},
+  {0x11357, 0x11357, WORD_CHARACTER_EXTEND},
+  {0x1135D, 0x11361, WORD_CHARACTER_LETTER},
+  {0x11362, 0x11363, WORD_CHARACTER_EXTEND},
+  {0x11366, 0x1136C, WORD_CHARACTER_EXTEND},
+  {0x11370, 0x11374, WORD_CHARACTER_EXTEND},
+  {0x11400, 0x11434, WORD_CHARACTER_LETTER},
+  {0x11435, 0x11446, WORD_CHARACTER_EXTEND},
+  {0x11447, 0x1144A, WORD_CHARACTER_LETTER},
+  {0x1144B, 0x1144F, WORD_CHARACTER_SEPARATOR},
+  {0x1145A, 0x1145B, WORD_CHARACTER_SEPARATOR},
+  {0x1145D, 0x1145D, WORD_CHARACTER_SEPARATOR},
+  {0x1145E, 0x1145E, WORD_CHARACTER_EXTEND},
+  {0x1145F, 0x11461, WORD_CHARACTER_LETTER},
+  {0x11480, 0x114AF, WORD_CHARACTER_LETTER},
+  {0x114B0, 0x114C3, WORD_CHARACTER_EXTEND},
+  {0x114C4, 0x114C5, WORD_CHARACTER_LETTER},
+  {0x114C6, 0x114C6, WORD_CHARACTER_SEPARATOR},
+  {0x114C7, 0x114C7, WORD_CHARACTER_LETTER},
+  {0x11580, 0x115AE, WORD_CHARACTER_LETTER},
+  {0x115AF, 0x115B5, WORD_CHARACTER_EXTEND},
+  {0x115B8, 0x115C0, WORD_CHARACTER_EXTEND},
+  {0x115C1, 0x115D7, WORD_CHARACTER_SEPARATOR},
+  {0x115D8, 0x115DB, WORD_CHARACTER_LETTER},
+  {0x115DC, 0x115DD, WORD_CHARACTER_EXTEND},
+  {0x11600, 0x1162F, WORD_CHARACTER_LETTER},
+  {0x11630, 0x11640, WORD_CHARACTER_EXTEND},
+  {0x11641, 0x11643, WORD_CHARACTER_SEPARATOR},
+  {0x11644, 0x11644, WORD_CHARACTER_LETTER},
+  {0x11660, 0x1166C, WORD_CHARACTER_SEPARATOR},
+  {0x11680, 0x116AA, WORD_CHARACTER_LETTER},
+  {0x116AB, 0x116B7, WORD_CHARACTER_EXTEND},
+  {0x116B8, 0x116B8, WORD_CHARACTER_LETTER},
+  {0x116B9, 0x116B9, WORD_CHARACTER_SEPARATOR},
+  {0x11700, 0x1171A, WORD_CHARACTER_LETTER},
+  {0x1171D, 0x1172B, WORD_CHARACTER_EXTEND},
+  {0x1173A, 0x1173F, WORD_CHARACTER_SEPARATOR},
+  {0x11740, 0x11746, WORD_CHARACTER_LETTER},
+  {0x11800, 0x1182B, WORD_CHARACTER_LETTER},
+  {0x1182C, 0x1183A, WORD_CHARACTER_EXTEND},
+  {0x1183B, 0x1183B, WORD_CHARACTER_SEPARATOR},
+  {0x118A0, 0x118DF, WORD_CHARACTER_LETTER},
+  {0x118EA, 0x118F2, WORD_CHARACTER_SEPARATOR},
+  {0x118FF, 0x11906, WORD_CHARACTER_LETTER},
+  {0x11909, 0x11909, WORD_CHARACTER_LETTER},
+  {0x1190C, 0x11913, WORD_CHARACTER_LETTER},
+  {0x11915, 0x11916, WORD_CHARACTER_LETTER},
+  {0x11918, 0x1192F, WORD_CHARACTER_LETTER},
+  {0x11930, 0x11935, WORD_CHARACTER_EXTEND},
+  {0x11937, 0x11938, WORD_CHARACTER_EXTEND},
+  {0x1193B, 0x1193E, WORD_CHARACTER_EXTEND},
+  {0x1193F, 0x1193F, WORD_CHARACTER_LETTER},
+  {0x11940, 0x11940, WORD_CHARACTER_EXTEND},
+  {0x11941, 0x11941, WORD_CHARACTER_LETTER},
+  {0x11942, 0x11943, WORD_CHARACTER_EXTEND},
+  {0x11944, 0x11946, WORD_CHARACTER_SEPARATOR},
+  {0x119A0, 0x119A7, WORD_CHARACTER_LETTER},
+  {0x119AA, 0x119D0, WORD_CHARACTER_LETTER},
+  {0x119D1, 0x119D7, WORD_CHARACTER_EXTEND},
+  {0x119DA, 0x119E0, WORD_CHARACTER_EXTEND},
+  {0x119E1, 0x119E1, WORD_CHARACTER_LETTER},
+  {0x119E2, 0x119E2, WORD_CHARACTER_SEPARATOR},
+  {0x119E3, 0x119E3, WORD_CHARACTER_LETTER},
+  {0x119E4, 0x119E4, WORD_CHARACTER_EXTEND},
+  {0x11A00, 0x11A00, WORD_CHARACTER_LETTER},
+  {0x11A01, 0x11A0A, WORD_CHARACTER_EXTEND},
+  {0x11A0B, 0x11A32, WORD_CHARACTER_LETTER},
+  {0x11A33, 0x11A39, WORD_CHARACTER_EXTEND},
+  {0x11A3A, 0x11A3A, WORD_CHARACTER_LETTER},
+  {0x11A3B, 0x11A3E, WORD_CHARACTER_EXTEND},
+  {0x11A3F, 0x11A46, WORD_CHARACTER_SEPARATOR},
+  {0x11A47, 0x11A47, WORD_CHARACTER_EXTEND},
+  {0x11A50, 0x11A50, WORD_CHARACTER_LETTER},
+  {0x11A51, 0x11A5B, WORD_CHARACTER_EXTEND},
+  {0x11A5C, 0x11A89, WORD_CHARACTER_LETTER},
+  {0x11A8A, 0x11A99, WORD_CHARACTER_EXTEND},
+  {0x11A9A, 0x11A9C, WORD_CHARACTER_SEPARATOR},
+  {0x11A9D, 0x11A9D, WORD_CHARACTER_LETTER},
+  {0x11A9E, 0x11AA2, WORD_CHARACTER_SEPARATOR},
+  {0x11AB0, 0x11AF8, WORD_CHARACTER_LETTER},
+  {0x11C00, 0x11C08, WORD_CHARACTER_LETTER},
+  {0x11C0A, 0x11C2E, WORD_CHARACTER_LETTER},
+  {0x11C2F, 0x11C36, WORD_CHARACTER_EXTEND},
+  {0x11C38, 0x11C3F, WORD_CHARACTER_EXTEND},
+  {0x11C40, 0x11C40, WORD_CHARACTER_LETTER},
+  {0x11C41, 0x11C45, WORD_CHARACTER_SEPARATOR},
+  {0x11C5A, 0x11C6C, WORD_CHARACTER_SEPARATOR},
+  {0x11C70, 0x11C71, WORD_CHARACTER_SEPARATOR},
+  {0x11C72, 0x11C8F, WORD_CHARACTER_LETTER},
+  {0x11C92, 0x11CA7, WORD_CHARACTER_EXTEND},
+  {0x11CA9, 0x11CB6, WORD_CHARACTER_EXTEND},
+  {0x11D00, 0x11D06, WORD_CHARACTER_LETTER},
+  {0x11D08, 0x11D09, WORD_CHARACTER_LETTER},
+  {0x11D0B, 0x11D30, WORD_CHARACTER_LETTER},
+  {0x11D31, 0x11D36, WORD_CHARACTER_EXTEND},
+  {0x11D3A, 0x11D3A, WORD_CHARACTER_EXTEND},
+  {0x11D3C, 0x11D3D, WORD_CHARACTER_EXTEND},
+  {0x11D3F, 0x11D45, WORD_CHARACTER_EXTEND},
+  {0x11D46, 0x11D46, WORD_CHARACTER_LETTER},
+  {0x11D47, 0x11D47, WORD_CHARACTER_EXTEND},
+  {0x11D60, 0x11D65, WORD_CHARACTER_LETTER},
+  {0x11D67, 0x11D68, WORD_CHARACTER_LETTER},
+  {0x11D6A, 0x11D89, WORD_CHARACTER_LETTER},
+  {0x11D8A, 0x11D8E, WORD_CHARACTER_EXTEND},
+  {0x11D90, 0x11D91, WORD_CHARACTER_EXTEND},
+  {0x11D93, 0x11D97, WORD_CHARACTER_EXTEND},
+  {0x11D98, 0x11D98, WORD_CHARACTER_LETTER},
+  {0x11EE0, 0x11EF2, WORD_CHARACTER_LETTER},
+  {0x11EF3, 0x11EF6, WORD_CHARACTER_EXTEND},
+  {0x11EF7, 0x11EF8, WORD_CHARACTER_SEPARATOR},
+  {0x11FB0, 0x11FB0, WORD_CHARACTER_LETTER},
+  {0x11FC0, 0x11FF1, WORD_CHARACTER_SEPARATOR},
+  {0x11FFF, 0x11FFF, WORD_CHARACTER_SEPARATOR},
+  {0x12000, 0x12399, WORD_CHARACTER_LETTER},
+  {0x12400, 0x1246E, WORD_CHARACTER_LETTER},
+  {0x12470, 0x12474, WORD_CHARACTER_SEPARATOR},
+  {0x12480, 0x12543, WORD_CHARACTER_LETTER},
+  {0x12F90, 0x12FF0, WORD_CHARACTER_LETTER},
+  {0x12FF1, 0x12FF2, WORD_CHARACTER_SEPARATOR},
+  {0x13000, 0x1342E, WORD_CHARACTER_LETTER},
+  {0x13430, 0x13438, WORD_CHARACTER_EXTEND},
+  {0x14400, 0x14646, WORD_CHARACTER_LETTER},
+  {0x16800, 0x16A38, WORD_CHARACTER_LETTER},
+  {0x16A40, 0x16A5E, WORD_CHARACTER_LETTER},
+  {0x16A6E, 0x16A6F, WORD_CHARACTER_SEPARATOR},
+  {0x16A70, 0x16ABE, WORD_CHARACTER_LETTER},
+  {0x16AD0, 0x16AED, WORD_CHARACTER_LETTER},
+  {0x16AF0, 0x16AF4, WORD_CHARACTER_EXTEND},
+  {0x16AF5, 0x16AF5, WORD_CHARACTER_SEPARATOR},
+  {0x16B00, 0x16B2F, WORD_CHARACTER_LETTER},
+  {0x16B30, 0x16B36, WORD_CHARACTER_EXTEND},
+  {0x16B37, 0x16B3F, WORD_CHARACTER_SEPARATOR},
+  {0x16B40, 0x16B43, WORD_CHARACTER_LETTER},
+  {0x16B44, 0x16B45, WORD_CHARACTER_SEPARATOR},
+  {0x16B5B, 0x16B61, WORD_CHARACTER_SEPARATOR},
+  {0x16B63, 0x16B77, WORD_CHARACTER_LETTER},
+  {0x16B7D, 0x16B8F, WORD_CHARACTER_LETTER},
+  {0x16E40, 0x16E7F, WORD_CHARACTER_LETTER},
+  {0x16E80, 0x16E9A, WORD_CHARACTER_SEPARATOR},
+  {0x16F00, 0x16F4A, WORD_CHARACTER_LETTER},
+  {0x16F4F, 0x16F4F, WORD_CHARACTER_EXTEND},
+  {0x16F50, 0x16F50, WORD_CHARACTER_LETTER},
+  {0x16F51, 0x16F87, WORD_CHARACTER_EXTEND},
+  {0x16F8F, 0x16F92, WORD_CHARACTER_EXTEND},
+  {0x16F93, 0x16F9F, WORD_CHARACTER_LETTER},
+  {0x16FE0, 0x16FE1, WORD_CHARACTER_LETTER},
+  {0x16FE2, 0x16FE2, WORD_CHARACTER_SEPARATOR},
+  {0x16FE3, 0x16FE3, WORD_CHARACTER_LETTER},
+  {0x16FE4, 0x16FE4, WORD_CHARACTER_EXTEND},
+  {0x16FF0, 0x16FF1, WORD_CHARACTER_EXTEND},
+  {0x17000, 0x187F7, WORD_CHARACTER_LETTER},
+  {0x18800, 0x18CD5, WORD_CHARACTER_LETTER},
+  {0x18D00, 0x18D08, WORD_CHARACTER_LETTER},
+  {0x1AFF0, 0x1AFF3, WORD_CHARACTER_LETTER},
+  {0x1AFF5, 0x1AFFB, WORD_CHARACTER_LETTER},
+  {0x1AFFD, 0x1AFFE, WORD_CHARACTER_LETTER},
+  {0x1B000, 0x1B122, WORD_CHARACTER_LETTER},
+  {0x1B150, 0x1B152, WORD_CHARACTER_LETTER},
+  {0x1B164, 0x1B167, WORD_CHARACTER_LETTER},
+  {0x1B170, 0x1B2FB, WORD_CHARACTER_LETTER},
+  {0x1BC00, 0x1BC6A, WORD_CHARACTER_LETTER},
+  {0x1BC70, 0x1BC7C, WORD_CHARACTER_LETTER},
+  {0x1BC80, 0x1BC88, WORD_CHARACTER_LETTER},
+  {0x1BC90, 0x1BC99, WORD_CHARACTER_LETTER},
+  {0x1BC9C, 0x1BC9C, WORD_CHARACTER_SEPARATOR},
+  {0x1BC9D, 0x1BC9E, WORD_CHARACTER_EXTEND},
+  {0x1BC9F, 0x1BC9F, WORD_CHARACTER_SEPARATOR},
+  {0x1BCA0, 0x1BCA3, WORD_CHARACTER_EXTEND},
+  {0x1CF00, 0x1CF2D, WORD_CHARACTER_EXTEND},
+  {0x1CF30, 0x1CF46, WORD_CHARACTER_EXTEND},
+  {0x1CF50, 0x1CFC3, WORD_CHARACTER_SEPARATOR},
+  {0x1D000, 0x1D0F5, WORD_CHARACTER_SEPARATOR},
+  {0x1D100, 0x1D126, WORD_CHARACTER_SEPARATOR},
+  {0x1D129, 0x1D164, WORD_CHARACTER_SEPARATOR},
+  {0x1D165, 0x1D169, WORD_CHARACTER_EXTEND},
+  {0x1D16A, 0x1D16C, WORD_CHARACTER_SEPARATOR},
+  {0x1D16D, 0x1D182, WORD_CHARACTER_EXTEND},
+  {0x1D183, 0x1D184, WORD_CHARACTER_SEPARATOR},
+  {0x1D185, 0x1D18B, WORD_CHARACTER_EXTEND},
+  {0x1D18C, 0x1D1A9, WORD_CHARACTER_SEPARATOR},
+  {0x1D1AA, 0x1D1AD, WORD_CHARACTER_EXTEND},
+  {0x1D1AE, 0x1D1EA, WORD_CHARACTER_SEPARATOR},
+  {0x1D200, 0x1D241, WORD_CHARACTER_SEPARATOR},
+  {0x1D242, 0x1D244, WORD_CHARACTER_EXTEND},
+  {0x1D245, 0x1D245, WORD_CHARACTER_SEPARATOR},
+  {0x1D2E0, 0x1D2F3, WORD_CHARACTER_SEPARATOR},
+  {0x1D300, 0x1D356, WORD_CHARACTER_SEPARATOR},
+  {0x1D360, 0x1D378, WORD_CHARACTER_SEPARATOR},
+  {0x1D400, 0x1D454, WORD_CHARACTER_LETTER},
+  {0x1D456, 0x1D49C, WORD_CHARACTER_LETTER},
+  {0x1D49E, 0x1D49F, WORD_CHARACTER_LETTER},
+  {0x1D4A2, 0x1D4A2, WORD_CHARACTER_LETTER},
+  {0x1D4A5, 0x1D4A6, WORD_CHARACTER_LETTER},
+  {0x1D4A9, 0x1D4AC, WORD_CHARACTER_LETTER},
+  {0x1D4AE, 0x1D4B9, WORD_CHARACTER_LETTER},
+  {0x1D4BB, 0x1D4BB, WORD_CHARACTER_LETTER},
+  {0x1D4BD, 0x1D4C3, WORD_CHARACTER_LETTER},
+  {0x1D4C5, 0x1D505, WORD_CHARACTER_LETTER},
+  {0x1D507, 0x1D50A, WORD_CHARACTER_LETTER},
+  {0x1D50D, 0x1D514, WORD_CHARACTER_LETTER},
+  {0x1D516, 0x1D51C, WORD_CHARACTER_LETTER},
+  {0x1D51E, 0x1D539, WORD_CHARACTER_LETTER},
+  {0x1D53B, 0x1D53E, WORD_CHARACTER_LETTER},
+  {0x1D540, 0x1D544, WORD_CHARACTER_LETTER},
+  {0x1D546, 0x1D546, WORD_CHARACTER_LETTER},
+  {0x1D54A, 0x1D550, WORD_CHARACTER_LETTER},
+  {0x1D552, 0x1D6A5, WORD_CHARACTER_LETTER},
+  {0x1D6A8, 0x1D6C0, WORD_CHARACTER_LETTER},
+  {0x1D6C1, 0x1D6C1, WORD_CHARACTER_SEPARATOR},
+  {0x1D6C2, 0x1D6DA, WORD_CHARACTER_LETTER},
+  {0x1D6DB, 0x1D6DB, WORD_CHARACTER_SEPARATOR},
+  {0x1D6DC, 0x1D6FA, WORD_CHARACTER_LETTER},
+  {0x1D6FB, 0x1D6FB, WORD_CHARACTER_SEPARATOR},
+  {0x1D6FC, 0x1D714, WORD_CHARACTER_LETTER},
+  {0x1D715, 0x1D715, WORD_CHARACTER_SEPARATOR},
+  {0x1D716, 0x1D734, WORD_CHARACTER_LETTER},
+  {0x1D735, 0x1D735, WORD_CHARACTER_SEPARATOR},
+  {0x1D736, 0x1D74E, WORD_CHARACTER_LETTER},
+  {0x1D74F, 0x1D74F, WORD_CHARACTER_SEPARATOR},
+  {0x1D750, 0x1D76E, WORD_CHARACTER_LETTER},
+  {0x1D76F, 0x1D76F, WORD_CHARACTER_SEPARATOR},
+  {0x1D770, 0x1D788, WORD_CHARACTER_LETTER},
+  {0x1D789, 0x1D789, WORD_CHARACTER_SEPARATOR},
+  {0x1D78A, 0x1D7A8, WORD_CHARACTER_LETTER},
+  {0x1D7A9, 0x1D7A9, WORD_CHARACTER_SEPARATOR},
+  {0x1D7AA, 0x1D7C2, WORD_CHARACTER_LETTER},
+  {0x1D7C3, 0x1D7C3, WORD_CHARACTER_SEPARATOR},
+  {0x1D7C4, 0x1D7CB, WORD_CHARACTER_LETTER},
+  {0x1D800, 0x1D9FF, WORD_CHARACTER_SEPARATOR},
+  {0x1DA00, 0x1DA36, WORD_CHARACTER_EXTEND},
+  {0x1DA37, 0x1DA3A, WORD_CHARACTER_SEPARATOR},
+  {0x1DA3B, 0x1DA6C, WORD_CHARACTER_EXTEND},
+  {0x1DA6D, 0x1DA74, WORD_CHARACTER_SEPARATOR},
+  {0x1DA75, 0x1DA75, WORD_CHARACTER_EXTEND},
+  {0x1DA76, 0x1DA83, WORD_CHARACTER_SEPARATOR},
+  {0x1DA84, 0x1DA84, WORD_CHARACTER_EXTEND},
+  {0x1DA85, 0x1DA8B, WORD_CHARACTER_SEPARATOR},
+  {0x1DA9B, 0x1DA9F, WORD_CHARACTER_EXTEND},
+  {0x1DAA1, 0x1DAAF, WORD_CHARACTER_EXTEND},
+  {0x1DF00, 0x1DF1E, WORD_CHARACTER_LETTER},
+  {0x1E000, 0x1E006, WORD_CHARACTER_EXTEND},
+  {0x1E008, 0x1E018, WORD_CHARACTER_EXTEND},
+  {0x1E01B, 0x1E021, WORD_CHARACTER_EXTEND},
+  {0x1E023, 0x1E024, WORD_CHARACTER_EXTEND},
+  {0x1E026, 0x1E02A, WORD_CHARACTER_EXTEND},
+  {0x1E100, 0x1E12C, WORD_CHARACTER_LETTER},
+  {0x1E130, 0x1E136, WORD_CHARACTER_EXTEND},
+  {0x1E137, 0x1E13D, WORD_CHARACTER_LETTER},
+  {0x1E14E, 0x1E14E, WORD_CHARACTER_LETTER},
+  {0x1E14F, 0x1E14F, WORD_CHARACTER_SEPARATOR},
+  {0x1E290, 0x1E2AD, WORD_CHARACTER_LETTER},
+  {0x1E2AE, 0x1E2AE, WORD_CHARACTER_EXTEND},
+  {0x1E2C0, 0x1E2EB, WORD_CHARACTER_LETTER},
+  {0x1E2EC, 0x1E2EF, WORD_CHARACTER_EXTEND},
+  {0x1E2FF, 0x1E2FF, WORD_CHARACTER_SEPARATOR},
+  {0x1E7E0, 0x1E7E6, WORD_CHARACTER_LETTER},
+  {0x1E7E8, 0x1E7EB, WORD_CHARACTER_LETTER},
+  {0x1E7ED, 0x1E7EE, WORD_CHARACTER_LETTER},
+  {0x1E7F0, 0x1E7FE, WORD_CHARACTER_LETTER},
+  {0x1E800, 0x1E8C4, WORD_CHARACTER_LETTER},
+  {0x1E8C7, 0x1E8CF, WORD_CHARACTER_SEPARATOR},
+  {0x1E8D0, 0x1E8D6, WORD_CHARACTER_EXTEND},
+  {0x1E900, 0x1E943, WORD_CHARACTER_LETTER},
+  {0x1E944, 0x1E94A, WORD_CHARACTER_EXTEND},
+  {0x1E94B, 0x1E94B, WORD_CHARACTER_LETTER},
+  {0x1E95E, 0x1E95F, WORD_CHARACTER_SEPARATOR},
+  {0x1EC71, 0x1ECB4, WORD_CHARACTER_SEPARATOR},
+  {0x1ED01, 0x1ED3D, WORD_CHARACTER_SEPARATOR},
+  {0x1EE00, 0x1EE03, WORD_CHARACTER_LETTER},
+  {0x1EE05, 0x1EE1F, WORD_CHARACTER_LETTER},
+  {0x1EE21, 0x1EE22, WORD_CHARACTER_LETTER},
+  {0x1EE24, 0x1EE24, WORD_CHARACTER_LETTER},
+  {0x1EE27, 0x1EE27, WORD_CHARACTER_LETTER},
+  {0x1EE29, 0x1EE32, WORD_CHARACTER_LETTER},
+  {0x1EE34, 0x1EE37, WORD_CHARACTER_LETTER},
+  {0x1EE39, 0x1EE39, WORD_CHARACTER_LETTER},
+  {0x1EE3B, 0x1EE3B, WORD_CHARACTER_LETTER},
+  {0x1EE42, 0x1EE42, WORD_CHARACTER_LETTER},
+  {0x1EE47, 0x1EE47, WORD_CHARACTER_LETTER},
+  {0x1EE49, 0x1EE49, WORD_CHARACTER_LETTER},
+  {0x1EE4B, 0x1EE4B, WORD_CHARACTER_LETTER},
+  {0x1EE4D, 0x1EE4F, WORD_CHARACTER_LETTER},
+  {0x1EE51, 0x1EE52, WORD_CHARACTER_LETTER},
+  {0x1EE54, 0x1EE54, WORD_CHARACTER_LETTER},
+  {0x1EE57, 0x1EE57, WORD_CHARACTER_LETTER},
+  {0x1EE59, 0x1EE59, WORD_CHARACTER_LETTER},
+  {0x1EE5B, 0x1EE5B, WORD_CHARACTER_LETTER},
+  {0x1EE5D, 0x1EE5D, WORD_CHARACTER_LETTER},
+  {0x1EE5F, 0x1EE5F, WORD_CHARACTER_LETTER},
+  {0x1EE61, 0x1EE62, WORD_CHARACTER_LETTER},
+  {0x1EE64, 0x1EE64, WORD_CHARACTER_LETTER},
+  {0x1EE67, 0x1EE6A, WORD_CHARACTER_LETTER},
+  {0x1EE6C, 0x1EE72, WORD_CHARACTER_LETTER},
+  {0x1EE74, 0x1EE77, WORD_CHARACTER_LETTER},
+  {0x1EE79, 0x1EE7C, WORD_CHARACTER_LETTER},
+  {0x1EE7E, 0x1EE7E, WORD_CHARACTER_LETTER},
+  {0x1EE80, 0x1EE89, WORD_CHARACTER_LETTER},
+  {0x1EE8B, 0x1EE9B, WORD_CHARACTER_LETTER},
+  {0x1EEA1, 0x1EEA3, WORD_CHARACTER_LETTER},
+  {0x1EEA5, 0x1EEA9, WORD_CHARACTER_LETTER},
+  {0x1EEAB, 0x1EEBB, WORD_CHARACTER_LETTER},
+  {0x1EEF0, 0x1EEF1, WORD_CHARACTER_SEPARATOR},
+  {0x1F000, 0x1F02B, WORD_CHARACTER_SEPARATOR},
+  {0x1F030, 0x1F093, WORD_CHARACTER_SEPARATOR},
+  {0x1F0A0, 0x1F0AE, WORD_CHARACTER_SEPARATOR},
+  {0x1F0B1, 0x1F0BF, WORD_CHARACTER_SEPARATOR},
+  {0x1F0C1, 0x1F0CF, WORD_CHARACTER_SEPARATOR},
+  {0x1F0D1, 0x1F0F5, WORD_CHARACTER_SEPARATOR},
+  {0x1F100, 0x1F1AD, WORD_CHARACTER_SEPARATOR},
+  {0x1F1E6, 0x1F202, WORD_CHARACTER_SEPARATOR},
+  {0x1F210, 0x1F23B, WORD_CHARACTER_SEPARATOR},
+  {0x1F240, 0x1F248, WORD_CHARACTER_SEPARATOR},
+  {0x1F250, 0x1F251, WORD_CHARACTER_SEPARATOR},
+  {0x1F260, 0x1F265, WORD_CHARACTER_SEPARATOR},
+  {0x1F300, 0x1F6D7, WORD_CHARACTER_SEPARATOR},
+  {0x1F6DD, 0x1F6EC, WORD_CHARACTER_SEPARATOR},
+  {0x1F6F0, 0x1F6FC, WORD_CHARACTER_SEPARATOR},
+  {0x1F700, 0x1F773, WORD_CHARACTER_SEPARATOR},
+  {0x1F780, 0x1F7D8, WORD_CHARACTER_SEPARATOR},
+  {0x1F7E0, 0x1F7EB, WORD_CHARACTER_SEPARATOR},
+  {0x1F7F0, 0x1F7F0, WORD_CHARACTER_SEPARATOR},
+  {0x1F800, 0x1F80B, WORD_CHARACTER_SEPARATOR},
+  {0x1F810, 0x1F847, WORD_CHARACTER_SEPARATOR},
+  {0x1F850, 0x1F859, WORD_CHARACTER_SEPARATOR},
+  {0x1F860, 0x1F887, WORD_CHARACTER_SEPARATOR},
+  {0x1F890, 0x1F8AD, WORD_CHARACTER_SEPARATOR},
+  {0x1F8B0, 0x1F8B1, WORD_CHARACTER_SEPARATOR},
+  {0x1F900, 0x1FA53, WORD_CHARACTER_SEPARATOR},
+  {0x1FA60, 0x1FA6D, WORD_CHARACTER_SEPARATOR},
+  {0x1FA70, 0x1FA74, WORD_CHARACTER_SEPARATOR},
+  {0x1FA78, 0x1FA7C, WORD_CHARACTER_SEPARATOR},
+  {0x1FA80, 0x1FA86, WORD_CHARACTER_SEPARATOR},
+  {0x1FA90, 0x1FAAC, WORD_CHARACTER_SEPARATOR},
+  {0x1FAB0, 0x1FABA, WORD_CHARACTER_SEPARATOR},
+  {0x1FAC0, 0x1FAC5, WORD_CHARACTER_SEPARATOR},
+  {0x1FAD0, 0x1FAD9, WORD_CHARACTER_SEPARATOR},
+  {0x1FAE0, 0x1FAE7, WORD_CHARACTER_SEPARATOR},
+  {0x1FAF0, 0x1FAF6, WORD_CHARACTER_SEPARATOR},
+  {0x1FB00, 0x1FB92, WORD_CHARACTER_SEPARATOR},
+  {0x1FB94, 0x1FBCA, WORD_CHARACTER_SEPARATOR},
+  {0x20000, 0x2A6DF, WORD_CHARACTER_LETTER},
+  {0x2A700, 0x2B738, WORD_CHARACTER_LETTER},
+  {0x2B740, 0x2B81D, WORD_CHARACTER_LETTER},
+  {0x2B820, 0x2CEA1, WORD_CHARACTER_LETTER},
+  {0x2CEB0, 0x2EBE0, WORD_CHARACTER_LETTER},
+  {0x2F800, 0x2FA1D, WORD_CHARACTER_LETTER},
+  {0x30000, 0x3134A, WORD_CHARACTER_LETTER},
+  {0xE0001, 0xE0001, WORD_CHARACTER_EXTEND},
+  {0xE0020, 0xE007F, WORD_CHARACTER_EXTEND},
+  {0xE0100, 0xE01EF, WORD_CHARACTER_EXTEND},
+  {0xF0000, 0xFFFFD, WORD_CHARACTER_SEPARATOR},
+  {0x100000, 0x10FFFD, WORD_CHARACTER_SEPARATOR},
+};
+
+const size_t kWordCharacterRangeCount = sizeof(kWordCharacterRanges) / sizeof(kWordCharacterRanges[0]);
+
+}  // namespace spellchecker
@@ -0,0 +1,391 @@
+#include <algorithm>
+#include <cstring>
+#include "word_segmenter.h"
+#include "ascii.h"
+#include "code_page.h"
+
+// Marks the characters that join letters into a word, on top of their type.
+#define WORD_CHARACTER_JOINER 0x80
+#define WORD_CHARACTER_TYPE_MASK 0x7F
+
+namespace spellchecker {
+
+namespace {
+
+bool IsHighSurrogate(uint16_t c) {
+  return c >= 0xD800 && c <= 0xDBFF;
+}
+
+bool IsLowSurrogate(uint16_t c) {
+  return c >= 0xDC00 && c <= 0xDFFF;
+}
+
+// Reads the character at a position, combining surrogate pairs, and returns
+// the number of UTF-16 units it takes.
+size_t ReadCharacter(const uint16_t *text, size_t length, size_t position, uint32_t *c) {
+  uint16_t unit = text[position];
+
+  if (IsHighSurrogate(unit) && position + 1 < length && IsLowSurrogate(text[position + 1])) {
+    *c = 0x10000 + ((unit - 0xD800) << 10) + (text[position + 1] - 0xDC00);
+    return 2;
+  }
+
+  *c = unit;
+  return 1;
+}
+
+// Read the characters of each encoding text is segmented in, with the
+// positions in its units, and skip runs of ASCII letters in blocks.
+struct UTF16Reader {
+  const uint16_t *text;
+  size_t length;
+
+  size_t Read(size_t position, uint32_t *c) const {
+    return ReadCharacter(text, length, position, c);
+  }
+
+  size_t SkipASCIILetters(size_t position) const {
+    return spellchecker::SkipASCIILetters(text, position, length);
+  }
+};
+
+struct Latin1Reader {
+  const char *text;
+  size_t length;
+
+  size_t Read(size_t position, uint32_t *c) const {
+    *c = static_cast<unsigned char>(text[position]);
+    return 1;
+  }
+
+  size_t SkipASCIILetters(size_t position) const {
+    return spellchecker::SkipASCIILetters(text, position, length);
+  }
+};
+
+struct UTF8Reader {
+  const char *text;
+  size_t length;
+
+  size_t Read(size_t position, uint32_t *c) const {
+    return DecodeUTF8Character(text + position, length - position, c);
+  }
+
+  size_t SkipASCIILetters(size_t position) const {
+    return spellchecker::SkipASCIILetters(text, position, length);
+  }
+};
+
+// Reads the next character of a UTF-8 string, or returns 0 at its end.
+uint32_t ReadUTF8Character(const unsigned char **utf8) {
+  const unsigned char *p = *utf8;
+  if (!*p) {
+    return 0;
+  }
+
+  uint32_t c = *p++;
+  int trailing = 0;
+
+  if (c >= 0xF0) {
+    c &= 0x07;
+    trailing = 3;
+  } else if (c >= 0xE0) {
+    c &= 0x0F;
+    trailing = 2;
+  } else if (c >= 0xC0) {
+    c &= 0x1F;
+    trailing = 1;
+  }
+
+  for (; trailing > 0 && (*p & 0xC0) == 0x80; trailing--) {
+    c = (c << 6) | (*p++ & 0x3F);
+  }
+
+  *utf8 = p;
+  return c;
+}
+
+bool CompareRange(const WordCharacterRange& range, uint32_t c) {
+  return range.last < c;
+}
+
+// Returns the type of a character after Latin-1 from the Unicode data.
+uint8_t GetUnicodeType(uint32_t c) {
+  const WordCharacterRange *end = kWordCharacterRanges + kWordCharacterRangeCount;
+  const WordCharacterRange *range = std::lower_bound(kWordCharacterRanges, end, c, CompareRange);
+  if (range != end && range->first <= c) {
+    return range->type;
+  }
+
+  return WORD_CHARACTER_OTHER;
+}
+
+bool IsASCIIUpper(uint32_t c) {
+  return c >= 'A' && c <= 'Z';
+}
+
+bool IsASCIILower(uint32_t c) {
+  return c >= 'a' && c <= 'z';
+}
+
+}  // namespace
+
+WordSegmenter::WordSegmenter() {
+  SetWordCharacters("");
+}
+
+void WordSegmenter::SetWordCharacters(const char *utf8_characters) {
+  memcpy(latin1, kLatin1WordCharacters, sizeof(latin1));
+  wordCharacters.clear();
+
+  // Apostrophes always join words, such as "doesn't".
+  latin1['\''] |= WORD_CHARACTER_JOINER;
+
+  // Only the separators among them join letters: letters make words anyway,
+  // and a word running into a digit is skipped even if the dictionary has
+  // digits among its word characters, as "file2name" is not a word to check.
+  const unsigned char *p = reinterpret_cast<const unsigned char *>(utf8_characters);
+  for (uint32_t c = ReadUTF8Character(&p); c; c = ReadUTF8Character(&p)) {
+    if (c < 0x100) {
+      if ((latin1[c] & WORD_CHARACTER_TYPE_MASK) == WORD_CHARACTER_SEPARATOR) {
+        latin1[c] |= WORD_CHARACTER_JOINER;
+      }
+    } else if (GetUnicodeType(c) == WORD_CHARACTER_SEPARATOR) {
+      wordCharacters.push_back(c);
+    }
+  }
+
+  std::sort(wordCharacters.begin(), wordCharacters.end());
+}
+
+uint8_t WordSegmenter::GetType(uint32_t c) const {
+  if (c < 0x100) {
+    return latin1[c];
+  }
+
+  uint8_t type = GetUnicodeType(c);
+  if (!wordCharacters.empty() && std::binary_search(wordCharacters.begin(), wordCharacters.end(), c)) {
+    type |= WORD_CHARACTER_JOINER;
+  }
+
+  return type;
+}
+
+uint8_t WordSegmenter::GetIdentifierType(uint32_t c) const {
+  if (c >= '0' && c <= '9') {
+    return WORD_CHARACTER_SEPARATOR;
+  }
+
+  uint8_t type = GetType(c) & WORD_CHARACTER_TYPE_MASK;
+  if (c == '\'' || c == 0x2019) {
+    type |= WORD_CHARACTER_JOINER;
+  }
+
+  return type;
+}
+
+template <typename Reader>
+bool WordSegmenter::FindWord(const Reader& reader, size_t length, size_t *position, size_t *word_start, size_t *word_end) const {
+  enum {
+    unknown,
+    in_separator,
+    in_word,
+  } state = in_separator;
+
+  size_t start = 0;
+  size_t i = *position;
+
+  while (i < length) {
+    uint32_t c;
+    size_t width = reader.Read(i, &c);
+    uint8_t type = GetType(c);
+    uint8_t kind = type & WORD_CHARACTER_TYPE_MASK;
+
+    switch (state) {
+      case unknown:
+        if (kind == WORD_CHARACTER_SEPARATOR) {
+          state = in_separator;
+        }
+        break;
+
+      case in_separator:
+        if (kind == WORD_CHARACTER_LETTER) {
+          start = i;
+          state = in_word;
+
+          if (c < 0x80) {
+            i = reader.SkipASCIILetters(i + 1);
+            continue;
+          }
+        } else if (kind == WORD_CHARACTER_OTHER) {
+          state = unknown;
+        }
+        break;
+
+      case in_word:
+        if (kind == WORD_CHARACTER_LETTER && c < 0x80) {
+          // Skip the rest of an ASCII word in blocks.
+          i = reader.SkipASCIILetters(i + 1);
+          continue;
+        }
+
+        if (kind == WORD_CHARACTER_LETTER || kind == WORD_CHARACTER_EXTEND) {
+          break;
+        }
+
+        // A word character carries the word on to a letter after it.
+        if ((type & WORD_CHARACTER_JOINER) && i + width < length) {
+          uint32_t next;
+          size_t next_width = reader.Read(i + width, &next);
+
+          if ((GetType(next) & WORD_CHARACTER_TYPE_MASK) == WORD_CHARACTER_LETTER) {
+            i += width + next_width;
+            continue;
+          }
+        }
+
+        if (kind == WORD_CHARACTER_SEPARATOR) {
+          *word_start = start;
+          *word_end = i;
+          *position = i + width;
+          return true;
+        }
+
+        state = unknown;
+        break;
+    }
+
+    i += width;
+  }
+
+  *position = length;
+
+  if (state == in_word) {
+    *word_start = start;
+    *word_end = length;
+    return true;
+  }
+
+  return false;
+}
+
+// Finds words the same way, without the block skips of ASCII letters, as
+// the case of each letter is needed to split the words of identifiers.
+template <typename Reader>
+bool WordSegmenter::FindIdentifierWord(const Reader& reader, size_t length, size_t *position, size_t *word_start, size_t *word_end) const {
+  enum {
+    unknown,
+    in_separator,
+    in_word,
+  } state = in_separator;
+
+  size_t start = 0;
+  size_t i = *position;
+  uint32_t previous = 0;
+
+  while (i < length) {
+    uint32_t c;
+    size_t width = reader.Read(i, &c);
+    uint8_t type = GetIdentifierType(c);
+    uint8_t kind = type & WORD_CHARACTER_TYPE_MASK;
+
+    switch (state) {
+      case unknown:
+        if (kind == WORD_CHARACTER_SEPARATOR) {
+          state = in_separator;
+        }
+        break;
+
+      case in_separator:
+        if (kind == WORD_CHARACTER_LETTER) {
+          start = i;
+          state = in_word;
+        } else if (kind == WORD_CHARACTER_OTHER) {
+          state = unknown;
+        }
+        break;
+
+      case in_word:
+        if (kind == WORD_CHARACTER_LETTER) {
+          // A capital after a small letter starts a word, as in "parseHttp",
+          // and so does the last of several capitals before a small letter,
+          // as in "HTTPResponse".
+          if (IsASCIIUpper(c)) {
+            uint32_t next = 0;
+            if (i + width < length) {
+              reader.Read(i + width, &next);
+            }
+
+            if (IsASCIILower(previous) || (IsASCIIUpper(previous) && IsASCIILower(next))) {
+              *word_start = start;
+              *word_end = i;
+              *position = i;
+              return true;
+            }
+          }
+          break;
+        }
+
+        if (kind == WORD_CHARACTER_EXTEND) {
+          break;
+        }
+
+        if ((type & WORD_CHARACTER_JOINER) && i + width < length) {
+          uint32_t next;
+          size_t next_width = reader.Read(i + width, &next);
+
+          if ((GetIdentifierType(next) & WORD_CHARACTER_TYPE_MASK) == WORD_CHARACTER_LETTER) {
+            previous = next;
+            i += width + next_width;
+            continue;
+          }
+        }
+
+        if (kind == WORD_CHARACTER_SEPARATOR) {
+          *word_start = start;
+          *word_end = i;
+          *position = i + width;
+          return true;
+        }
+
+        state = unknown;
+        break;
+    }
+
+    previous = c;
+    i += width;
+  }
+
+  *position = length;
+
+  if (state == in_word) {
+    *word_start = start;
+    *word_end = length;
+    return true;
+  }
+
+  return false;
+}
+
+bool WordSegmenter::NextWord(const uint16_t *text, size_t length, size_t *position, size_t *word_start, size_t *word_end, bool splitIdentifiers) const {
+  UTF16Reader reader = {text, length};
+  return splitIdentifiers ?
+    FindIdentifierWord(reader, length, position, word_start, word_end) :
+    FindWord(reader, length, position, word_start, word_end);
+}
+
+bool WordSegmenter::NextLatin1Word(const char *text, size_t length, size_t *position, size_t *word_start, size_t *word_end, bool splitIdentifiers) const {
+  Latin1Reader reader = {text, length};
+  return splitIdentifiers ?
+    FindIdentifierWord(reader, length, position, word_start, word_end) :
+    FindWord(reader, length, position, word_start, word_end);
+}
+
+bool WordSegmenter::NextUTF8Word(const char *text, size_t length, size_t *position, size_t *word_start, size_t *word_end, bool splitIdentifiers) const {
+  UTF8Reader reader = {text, length};
+  return splitIdentifiers ?
+    FindIdentifierWord(reader, length, position, word_start, word_end) :
+    FindWord(reader, length, position, word_start, word_end);
+}
+
+}  // namespace spellchecker
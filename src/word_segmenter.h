@@ -0,0 +1,88 @@
+#ifndef SRC_WORD_SEGMENTER_H_
+#define SRC_WORD_SEGMENTER_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <vector>
+
+namespace spellchecker {
+
+enum WordCharacterType {
+  // Digits, controls and unassigned characters: a word touching them is
+  // not checked.
+  WORD_CHARACTER_OTHER,
+  // Letters, which make words.
+  WORD_CHARACTER_LETTER,
+  // Combining marks and format characters, which belong to the character
+  // before them.
+  WORD_CHARACTER_EXTEND,
+  // Whitespace, punctuation and symbols, which end words.
+  WORD_CHARACTER_SEPARATOR,
+};
+
+struct WordCharacterRange {
+  uint32_t first;
+  uint32_t last;
+  uint8_t type;
+};
+
+// The types of the characters, generated from the Unicode data in
+// word_characters.cc. The ranges cover the characters after Latin-1 that are
+// not WORD_CHARACTER_OTHER, in order.
+extern const uint8_t kLatin1WordCharacters[256];
+extern const WordCharacterRange kWordCharacterRanges[];
+extern const size_t kWordCharacterRangeCount;
+
+// Splits text into the words to check, the same way on every host
+// instead of by the character classes of the C library's locale.
+//
+// A word is a run of letters, which also continues across an apostrophe or
+// one of the word characters of the dictionary when a letter follows it. A
+// separator or the end of the text ends a word, while a word running into a
+// digit or another character, such as "abc123" or "file2name", is skipped up
+// to the next separator, even if the dictionary has digits among its word
+// characters.
+//
+// Identifiers in source code can be split into their words instead, as in
+// "parseHTTP_response2" to "parse", "HTTP" and "response". Digits then end
+// words, only apostrophes join letters, and an ASCII capital starts a new
+// word after a small letter, or before a small letter after other capitals.
+class WordSegmenter {
+public:
+  WordSegmenter();
+
+  // Sets the characters that join letters into a word, such as the WORDCHARS
+  // of a Hunspell dictionary, given in UTF-8. Only the separators among them
+  // are taken.
+  void SetWordCharacters(const char *utf8_characters);
+
+  // Finds the next word starting from *position, which is moved past the
+  // end of the word. Returns false if there are no more words.
+  bool NextWord(const uint16_t *text, size_t length, size_t *position, size_t *word_start, size_t *word_end, bool splitIdentifiers) const;
+
+  // The same for Latin-1 or UTF-8 text, with the positions in bytes.
+  bool NextLatin1Word(const char *text, size_t length, size_t *position, size_t *word_start, size_t *word_end, bool splitIdentifiers) const;
+  bool NextUTF8Word(const char *text, size_t length, size_t *position, size_t *word_start, size_t *word_end, bool splitIdentifiers) const;
+
+private:
+  uint8_t GetType(uint32_t c) const;
+
+  // Returns the type of a character within identifiers.
+  uint8_t GetIdentifierType(uint32_t c) const;
+
+  template <typename Reader>
+  bool FindWord(const Reader& reader, size_t length, size_t *position, size_t *word_start, size_t *word_end) const;
+
+  template <typename Reader>
+  bool FindIdentifierWord(const Reader& reader, size_t length, size_t *position, size_t *word_start, size_t *word_end) const;
+
+  // The types of the Latin-1 characters, with the word characters marked.
+  uint8_t latin1[256];
+
+  // The word characters after Latin-1, sorted.
+  std::vector<uint32_t> wordCharacters;
+};
+
+}  // namespace spellchecker
+
+#endif  // SRC_WORD_SEGMENTER_H_
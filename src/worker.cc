@@ -3,12 +3,192 @@
 #include "nan.h"
 #include "spellchecker.h"
 
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstring>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
+namespace {
+
+// Texts shorter than this are checked on the worker thread alone.
+const size_t kParallelCheckMinLength = 256 * 1024;
+
+// The length long texts are split at, before moving to the next whitespace.
+const size_t kParallelCheckChunkLength = 64 * 1024;
+
+// Batches of fewer words are checked on one thread, and larger ones in parts
+// of this many words.
+const size_t kParallelBatchMinWords = 16 * 1024;
+const size_t kParallelBatchPartWords = 4 * 1024;
+
+// Threads lent to the parallel checks besides the worker threads running
+// them, shared by all checks so that checks at the same time do not
+// oversubscribe the cores.
+std::atomic<int> g_helperThreads(std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0);
+
+// Takes up to max of the free helper threads.
+int AcquireHelperThreads(int max) {
+  int free = g_helperThreads.load();
+  int taken;
+  do {
+    taken = std::min(free, max);
+    if (taken <= 0) {
+      return 0;
+    }
+  } while (!g_helperThreads.compare_exchange_weak(free, free - taken));
+
+  return taken;
+}
+
+// Runs work on the calling thread and on as many free helper threads as
+// there are parts of it besides the first, up to the cores left over. Each
+// thread runs the function, which takes the next part until there are none
+// left, so the parts are done even when no helper is free.
+template <typename Work>
+void RunOnHelpers(size_t partCount, const Work& work) {
+  int helpers = partCount > 1 ? AcquireHelperThreads(static_cast<int>(std::min<size_t>(partCount - 1, INT_MAX))) : 0;
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < helpers; i++) {
+    threads.emplace_back(work);
+  }
+
+  // The calling thread does its share rather than waiting idle.
+  work();
+
+  for (auto iter = threads.begin(); iter != threads.end(); ++iter) {
+    iter->join();
+  }
+
+  g_helperThreads += helpers;
+}
+
+bool IsChunkBoundary(uint16_t c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// Returns the bounds of the chunks a text is checked in. Chunks start after
+// whitespace, which ends any word and any match of the ignore patterns, so
+// neither is split between chunks and each chunk is checked the same as
+// within the whole text.
+template <typename Unit>
+std::vector<size_t> SplitIntoChunks(const Unit *text, size_t length) {
+  std::vector<size_t> bounds(1, 0);
+
+  for (size_t next = kParallelCheckChunkLength; next < length; next += kParallelCheckChunkLength) {
+    while (next < length && !IsChunkBoundary(text[next - 1])) {
+      next++;
+    }
+
+    if (next < length) {
+      bounds.push_back(next);
+    }
+  }
+
+  bounds.push_back(length);
+  return bounds;
+}
+
+// Checks the chunks of a long text on the worker thread and the free helper
+// threads. Each thread takes the next unchecked chunk until there are none
+// left, and the ranges are merged back in the order of the chunks.
+std::vector<MisspelledRange> CheckSpellingInParallel(SpellcheckerImplementation *impl, const Corpus& corpus) {
+  std::vector<size_t> bounds = corpus.utf16 ?
+    SplitIntoChunks(corpus.utf16, corpus.length) :
+    SplitIntoChunks(corpus.bytes, corpus.length);
+  size_t chunkCount = bounds.size() - 1;
+
+  // The ranges are in UTF-16 units, so the chunks of UTF-8 text are offset
+  // by the UTF-16 length of the text before them.
+  std::vector<size_t> offsets(bounds.begin(), bounds.end() - 1);
+  if (corpus.bytes && corpus.encoding == UTF8_TEXT) {
+    for (size_t chunk = 1; chunk < chunkCount; chunk++) {
+      offsets[chunk] = offsets[chunk - 1] + CountUTF16Units(corpus.bytes + bounds[chunk - 1], bounds[chunk] - bounds[chunk - 1]);
+    }
+  }
+
+  std::vector<std::vector<MisspelledRange>> chunkRanges(chunkCount);
+  std::atomic<size_t> nextChunk(0);
+
+  auto checkChunks = [&]() {
+    std::unique_ptr<SpellcheckerThreadView> view = impl->CreateThreadView();
+
+    for (size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++) {
+      size_t start = bounds[chunk], length = bounds[chunk + 1] - start;
+      if (corpus.utf16) {
+        view->CheckSpelling(corpus.utf16 + start, length, corpus.format, &chunkRanges[chunk]);
+      } else {
+        view->CheckSpelling(corpus.bytes + start, length, corpus.encoding, corpus.format, &chunkRanges[chunk]);
+      }
+
+      for (auto iter = chunkRanges[chunk].begin(); iter != chunkRanges[chunk].end(); ++iter) {
+        iter->start += offsets[chunk];
+        iter->end += offsets[chunk];
+      }
+    }
+  };
+
+  RunOnHelpers(chunkCount, checkChunks);
+
+  std::vector<MisspelledRange> result;
+  for (auto iter = chunkRanges.begin(); iter != chunkRanges.end(); ++iter) {
+    result.insert(result.end(), iter->begin(), iter->end());
+  }
+
+  return result;
+}
+
+// Finds the corrections of a batch of words on the worker thread and the free
+// helper threads, each taking the next word until there are none left.
+std::vector<std::vector<std::string>> GetCorrectionsInParallel(SpellcheckerImplementation *impl, const std::vector<std::string>& words, const SuggestionOptions& options) {
+  std::vector<std::vector<std::string>> result(words.size());
+  std::atomic<size_t> nextWord(0);
+
+  auto getCorrections = [&]() {
+    std::unique_ptr<SpellcheckerThreadView> view = impl->CreateThreadView();
+
+    for (size_t word = nextWord++; word < words.size(); word = nextWord++) {
+      result[word] = view->GetCorrectionsForMisspelling(words[word], options);
+    }
+  };
+
+  RunOnHelpers(words.size(), getCorrections);
+
+  return result;
+}
+
+}  // namespace
+
+void CheckWordBatch(SpellcheckerImplementation *impl, const WordBatch& batch, uint8_t *misspelled) {
+  size_t count = batch.words.size();
+  if (count < kParallelBatchMinWords || !impl->CanCheckInParallel()) {
+    std::unique_ptr<SpellcheckerThreadView> view = impl->CreateThreadView();
+    view->IsMisspelled(batch.bytes, batch.words.data(), count, misspelled);
+    return;
+  }
+
+  size_t partCount = (count + kParallelBatchPartWords - 1) / kParallelBatchPartWords;
+  std::atomic<size_t> nextPart(0);
+
+  auto checkParts = [&]() {
+    std::unique_ptr<SpellcheckerThreadView> view = impl->CreateThreadView();
+
+    for (size_t part = nextPart++; part < partCount; part = nextPart++) {
+      size_t start = part * kParallelBatchPartWords;
+      size_t length = std::min(kParallelBatchPartWords, count - start);
+      view->IsMisspelled(batch.bytes, batch.words.data() + start, length, misspelled + start);
+    }
+  };
+
+  RunOnHelpers(partCount, checkParts);
+}
+
 CheckSpellingWorker::CheckSpellingWorker(
-  std::vector<uint16_t>&& corpus,
+  Corpus&& corpus,
   SpellcheckerImplementation* impl,
   Nan::Callback* callback
 ) : AsyncWorker(callback), corpus(std::move(corpus)), impl(impl)
@@ -22,25 +202,178 @@ CheckSpellingWorker::~CheckSpellingWorker()
 }
 
 void CheckSpellingWorker::Execute() {
+  // Markup can run across whitespace, as a comment or a code block does, so
+  // only plain text and source code, whose literals end at whitespace, are
+  // split into chunks.
+  if ((corpus.format == PLAIN_TEXT_FORMAT || corpus.format == SOURCE_CODE_FORMAT) && corpus.length >= kParallelCheckMinLength && impl->CanCheckInParallel()) {
+    misspelled_ranges = CheckSpellingInParallel(impl, corpus);
+    return;
+  }
+
   std::unique_ptr<SpellcheckerThreadView> view = impl->CreateThreadView();
-  misspelled_ranges = view->CheckSpelling(corpus.data(), corpus.size());
+  if (corpus.utf16) {
+    view->CheckSpelling(corpus.utf16, corpus.length, corpus.format, &misspelled_ranges);
+  } else {
+    view->CheckSpelling(corpus.bytes, corpus.length, corpus.encoding, corpus.format, &misspelled_ranges);
+  }
 }
 
 void CheckSpellingWorker::HandleOKCallback() {
   Nan::HandleScope scope;
 
+  Local<Value> argv[] = { Nan::Null(), MisspelledRangesToJS(misspelled_ranges, GetFromPersistent("packed")) };
+  callback->Call(2, argv);
+}
+
+IsMisspelledBatchWorker::IsMisspelledBatchWorker(
+  WordBatch&& batch,
+  SpellcheckerImplementation* impl,
+  Nan::Callback* callback
+) : AsyncWorker(callback), batch(std::move(batch)), impl(impl)
+{
+  // No-op
+}
+
+IsMisspelledBatchWorker::~IsMisspelledBatchWorker()
+{
+  // No-op
+}
+
+void IsMisspelledBatchWorker::Execute() {
+  misspelled.resize(batch.words.size());
+  CheckWordBatch(impl, batch, misspelled.data());
+}
+
+void IsMisspelledBatchWorker::HandleOKCallback() {
+  Nan::HandleScope scope;
+
+  size_t length = misspelled.size();
+  Local<Uint8Array> result = Uint8Array::New(ArrayBuffer::New(Isolate::GetCurrent(), length), 0, length);
+  if (length > 0) {
+    Nan::TypedArrayContents<uint8_t> contents(result);
+    memcpy(*contents, misspelled.data(), length);
+  }
+
+  Local<Value> argv[] = { Nan::Null(), result };
+  callback->Call(2, argv);
+}
+
+GetCorrectionsWorker::GetCorrectionsWorker(
+  std::vector<std::string>&& words,
+  const SuggestionOptions& options,
+  SpellcheckerImplementation* impl,
+  Nan::Callback* callback
+) : AsyncWorker(callback), words(std::move(words)), options(options), impl(impl)
+{
+  // No-op
+}
+
+GetCorrectionsWorker::~GetCorrectionsWorker()
+{
+  // No-op
+}
+
+void GetCorrectionsWorker::Execute() {
+  if (words.size() > 1 && impl->CanCheckInParallel()) {
+    corrections = GetCorrectionsInParallel(impl, words, options);
+    return;
+  }
+
+  std::unique_ptr<SpellcheckerThreadView> view = impl->CreateThreadView();
+  for (auto iter = words.begin(); iter != words.end(); ++iter) {
+    corrections.push_back(view->GetCorrectionsForMisspelling(*iter, options));
+  }
+}
+
+void GetCorrectionsWorker::HandleOKCallback() {
+  Nan::HandleScope scope;
+
+  v8::Local<v8::Context> context = Nan::GetCurrentContext();
+  Local<Array> result = Nan::New<Array>(corrections.size());
+  for (size_t i = 0; i < corrections.size(); ++i) {
+    result->Set(context, i, CorrectionsToJS(corrections[i]));
+  }
+
+  Local<Value> argv[] = { Nan::Null(), result };
+  callback->Call(2, argv);
+}
+
+SetDictionaryWorker::SetDictionaryWorker(
+  std::vector<std::string>&& languages,
+  const std::string& directory,
+  SpellcheckerImplementation* impl,
+  Nan::Callback* callback
+) : AsyncWorker(callback), languages(std::move(languages)), directory(directory), impl(impl), result(false)
+{
+  // No-op
+}
+
+SetDictionaryWorker::~SetDictionaryWorker()
+{
+  // No-op
+}
+
+void SetDictionaryWorker::Execute() {
+  result = impl->SetDictionaries(languages, directory);
+}
+
+void SetDictionaryWorker::HandleOKCallback() {
+  Nan::HandleScope scope;
+
+  Local<Value> argv[] = { Nan::Null(), Nan::New(result) };
+  callback->Call(2, argv);
+}
+
+Local<Array> CorrectionsToJS(const std::vector<std::string>& corrections) {
+  v8::Local<v8::Context> context = Nan::GetCurrentContext();
+  Local<Array> result = Nan::New<Array>(corrections.size());
+  for (size_t i = 0; i < corrections.size(); ++i) {
+    const std::string& word = corrections[i];
+
+    Nan::MaybeLocal<String> val = Nan::New<String>(word.data(), word.size());
+    result->Set(context, i, val.ToLocalChecked());
+  }
+
+  return result;
+}
+
+Local<Value> MisspelledRangesToJS(const std::vector<MisspelledRange>& ranges, Local<Value> packed) {
+  if (packed->IsTrue() || packed->IsUint32Array()) {
+    size_t length = ranges.size() * 2;
+    Local<Uint32Array> result;
+
+    // Write into the given array when the ranges fit, and return the part of
+    // it they take.
+    if (packed->IsUint32Array() && Nan::TypedArrayContents<uint32_t>(packed).length() >= length) {
+      Local<Uint32Array> buffer = packed.As<Uint32Array>();
+      result = Uint32Array::New(buffer->Buffer(), buffer->ByteOffset(), length);
+    } else {
+      result = Uint32Array::New(ArrayBuffer::New(Isolate::GetCurrent(), length * sizeof(uint32_t)), 0, length);
+    }
+
+    Nan::TypedArrayContents<uint32_t> contents(result);
+    uint32_t *pairs = *contents;
+    for (auto iter = ranges.begin(); iter != ranges.end(); ++iter) {
+      *pairs++ = iter->start;
+      *pairs++ = iter->end;
+    }
+
+    return result;
+  }
+
   v8::Local<v8::Context> context = Nan::GetCurrentContext();
-  Local<Array> result = Nan::New<Array>();
-  for (auto iter = misspelled_ranges.begin(); iter != misspelled_ranges.end(); ++iter) {
-    size_t index = iter - misspelled_ranges.begin();
-    uint32_t start = iter->start, end = iter->end;
+  Local<String> start = Nan::New("start").ToLocalChecked();
+  Local<String> end = Nan::New("end").ToLocalChecked();
+
+  Local<Array> result = Nan::New<Array>(ranges.size());
+  for (auto iter = ranges.begin(); iter != ranges.end(); ++iter) {
+    size_t index = iter - ranges.begin();
 
     Local<Object> misspelled_range = Nan::New<Object>();
-    misspelled_range->Set(context, Nan::New("start").ToLocalChecked(), Nan::New<Integer>(start));
-    misspelled_range->Set(context, Nan::New("end").ToLocalChecked(), Nan::New<Integer>(end));
+    misspelled_range->Set(context, start, Nan::New<Integer>(static_cast<uint32_t>(iter->start)));
+    misspelled_range->Set(context, end, Nan::New<Integer>(static_cast<uint32_t>(iter->end)));
     result->Set(context, index, misspelled_range);
   }
 
-  Local<Value> argv[] = { Nan::Null(), result };
-  callback->Call(2, argv);
+  return result;
 }
@@ -4,22 +4,114 @@
 #include "nan.h"
 #include "spellchecker.h"
 
+#include <string>
 #include <vector>
 
 using namespace spellchecker;
 using namespace v8;
 
+// The text of a check. It points into a typed array or an external string
+// that is read in place, or into the copy of a string or typed array the
+// corpus owns. Text checked by a worker never points into a typed array.
+struct Corpus {
+  Corpus() : utf16(NULL), bytes(NULL), encoding(LATIN1_TEXT), length(0), format(PLAIN_TEXT_FORMAT) {}
+
+  // Set for UTF-16 text.
+  const uint16_t *utf16;
+
+  // Set for Latin-1 or UTF-8 text, in the given encoding.
+  const char *bytes;
+  TextEncoding encoding;
+
+  size_t length;
+
+  // The markup to skip, if any.
+  TextFormat format;
+
+  std::vector<uint16_t> utf16Copy;
+  std::vector<char> bytesCopy;
+};
+
+// The words of a batch check, in UTF-8. They are in a typed array that is
+// read in place, or in the copy of the strings of an array or of a typed
+// array the batch owns. Words checked by a worker are always copied.
+struct WordBatch {
+  WordBatch() : bytes(NULL) {}
+
+  const char *bytes;
+  std::vector<WordRange> words;
+
+  std::vector<char> bytesCopy;
+};
+
 class CheckSpellingWorker : public Nan::AsyncWorker {
 public:
-  CheckSpellingWorker(std::vector<uint16_t> &&corpus, SpellcheckerImplementation* impl, Nan::Callback* callback);
+  // An external string the corpus reads in place must be kept alive until
+  // the worker is done, such as with SaveToPersistent.
+  CheckSpellingWorker(Corpus &&corpus, SpellcheckerImplementation* impl, Nan::Callback* callback);
   ~CheckSpellingWorker();
 
   void Execute();
   void HandleOKCallback();
 private:
-  const std::vector<uint16_t> corpus;
+  const Corpus corpus;
   SpellcheckerImplementation* impl;
   std::vector<MisspelledRange> misspelled_ranges;
 };
 
+class GetCorrectionsWorker : public Nan::AsyncWorker {
+public:
+  GetCorrectionsWorker(std::vector<std::string> &&words, const SuggestionOptions& options, SpellcheckerImplementation* impl, Nan::Callback* callback);
+  ~GetCorrectionsWorker();
+
+  void Execute();
+  void HandleOKCallback();
+private:
+  const std::vector<std::string> words;
+  const SuggestionOptions options;
+  SpellcheckerImplementation* impl;
+  std::vector<std::vector<std::string>> corrections;
+};
+
+class IsMisspelledBatchWorker : public Nan::AsyncWorker {
+public:
+  // The batch must own its words, as a typed array's buffer can be detached
+  // while the worker runs.
+  IsMisspelledBatchWorker(WordBatch &&batch, SpellcheckerImplementation* impl, Nan::Callback* callback);
+  ~IsMisspelledBatchWorker();
+
+  void Execute();
+  void HandleOKCallback();
+private:
+  const WordBatch batch;
+  SpellcheckerImplementation* impl;
+  std::vector<uint8_t> misspelled;
+};
+
+class SetDictionaryWorker : public Nan::AsyncWorker {
+public:
+  SetDictionaryWorker(std::vector<std::string> &&languages, const std::string& directory, SpellcheckerImplementation* impl, Nan::Callback* callback);
+  ~SetDictionaryWorker();
+
+  void Execute();
+  void HandleOKCallback();
+private:
+  const std::vector<std::string> languages;
+  const std::string directory;
+  SpellcheckerImplementation* impl;
+  bool result;
+};
+
+// Sets misspelled[i] to whether the i-th word of the batch is misspelled.
+// Large batches are split between threads.
+void CheckWordBatch(SpellcheckerImplementation *impl, const WordBatch& batch, uint8_t *misspelled);
+
+// Returns the corrections as an Array of strings.
+Local<Array> CorrectionsToJS(const std::vector<std::string>& corrections);
+
+// Returns the ranges as an Array of {start, end} objects, or, if packed is
+// true or a Uint32Array, as a Uint32Array of [start, end] pairs. The pairs
+// are written into the given Uint32Array when they fit in it.
+Local<Value> MisspelledRangesToJS(const std::vector<MisspelledRange>& ranges, Local<Value> packed);
+
 #endif